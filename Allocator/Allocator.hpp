@@ -313,7 +313,9 @@ public:
 ///
 /// INFO: This is the copy & move assignment operator for the Allocator template class.
 Allocator& operator = (const Allocator& copy) noexcept
-{}
+{
+    return *this;
+}
 
 /// AUTH: MSP
 /// VISI: public
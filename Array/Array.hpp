@@ -25,118 +25,187 @@
 #include "Keywords.hpp"
 #include "Types.hpp"
 #include "Exceptions.hpp"
+#include "Sort.hpp"
 
-#include <cstring> // exclusively for std::memcpy() and std::memset()
+#include <type_traits> // exclusively for std::is_arithmetic, std::is_trivially_copyable, & std::conditional
 
 namespace alt // Array belongs to namespace alt
 {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// NOTE: the width of an AVX register, see ArrayMath.hpp.  It's fixed rather than taken from whatever the translation
+/// unit is compiled for, so that an Array has the same layout in every translation unit regardless of their -m or
+/// /arch flags.
+READONLY u64 SIMD_REGISTER_BYTES = 32;
+
+/// NOTE: arithmetic elements which fill at least one SIMD register are aligned to its width, everything else keeps its
+/// natural alignment so that small arrays don't grow any more than they have to
 template <typename Datatype, i64 _Capacity>
-class Array
+constexpr u64 _ArrayAlignment(void) noexcept
 {
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// MEMBER VARIABLES
-private:
+	if (std::is_arithmetic<Datatype>::value && alignof(Datatype) < SIMD_REGISTER_BYTES &&
+		sizeof(Datatype) * _Capacity >= SIMD_REGISTER_BYTES)
+		return SIMD_REGISTER_BYTES;
+	return alignof(Datatype);
+}
 
-	i64 _Count;
-	Datatype _Array[_Capacity];
+/// NOTE: the smallest signed integer which holds every count from -1 (moved from) up to _Capacity
+template <i64 _Capacity>
+using _ArrayCountType = typename std::conditional<(_Capacity <= 0x7F), i8,
+                        typename std::conditional<(_Capacity <= 0x7FFF), i16,
+                        typename std::conditional<(_Capacity <= 0x7FFFFFFF), i32, i64>::type>::type>::type;
 
-////////////////////////////////////////////////////////////////////////////////
-/// DEFAULT CONSTRUCTOR & DESTRUCTOR
-public:
+/// NOTE: the elements come before the count so that a narrow count packs into the tail padding instead of adding its
+/// own, e.g. an Array<u8, 8> is 9 bytes.  When Datatype is trivially copyable the copy & move operations are the
+/// implicit ones, so the whole Array is trivially copyable too & copies as one fixed size block; otherwise they copy
+/// & move only the live elements.
+template <typename Datatype, i64 _Capacity, bool _Trivial = std::is_trivially_copyable<Datatype>::value>
+class _ArrayStorage
+{
+protected:
 
-Array() noexcept:
-	_Count(0),
-	_Array{0}
-{}
+	alignas(_ArrayAlignment<Datatype, _Capacity>()) Datatype _Array[_Capacity];
+	_ArrayCountType<_Capacity> _Count;
 
-virtual
-~Array() noexcept
+constexpr _ArrayStorage() noexcept:
+	_Array{},
+	_Count(0)
 {}
 
-////////////////////////////////////////////////////////////////////////////////
-/// OVERLOADED CONSTRUCTORS
-public:
+};
 
-explicit Array(const i64 init_count, Datatype* const init_array) noexcept:
-	_Count(init_count),
-	_Array{0}
+template <typename Datatype, i64 _Capacity>
+class _ArrayStorage<Datatype, _Capacity, false>
 {
-	if (( this->_Count > 0 )&&
-		( init_array != nullptr ))
-		std::memcpy(this->_Array, init_array, Datasize(this->_Count));
-}
+protected:
 
-////////////////////////////////////////////////////////////////////////////////
-/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
-public:
+	alignas(_ArrayAlignment<Datatype, _Capacity>()) Datatype _Array[_Capacity];
+	_ArrayCountType<_Capacity> _Count;
 
-Array(const Array& copy) noexcept:
-	_Count(copy._Count),
-	_Array{0}
+constexpr _ArrayStorage() noexcept:
+	_Array{},
+	_Count(0)
+{}
+
+constexpr _ArrayStorage(const _ArrayStorage& copy) noexcept:
+	_Array{},
+	_Count(copy._Count)
 {
-	if (this->_Count > 0)
-		std::memcpy(this->_Array, copy._Array, Datasize(this->_Count));
+	for (i64 i = 0; i < this->_Count; i++)
+		this->_Array[i] = copy._Array[i];
 }
 
-Array(Array&& move) noexcept:
-	_Count(move._Count),
-	_Array{0}
+/// NOTE: the moved from elements are left value initialized
+constexpr _ArrayStorage(_ArrayStorage&& move) noexcept:
+	_Array{},
+	_Count(move._Count)
 {
 	if (this->_Count >= 0)
 	{
-		if (this->_Count > 0)
-			std::memcpy(this->_Array, move._Array, Datasize(this->_Count));
-		std::memset(move._Array, 0, Datasize(move._Count));
+		for (i64 i = 0; i < this->_Count; i++)
+		{
+			this->_Array[i] = (Datatype&&)(move._Array[i]);
+			move._Array[i] = Datatype {};
+		}
 		move._Count = -1;
 	}
 }
 
-Array& operator = (const Array& copy) noexcept
+constexpr _ArrayStorage& operator = (const _ArrayStorage& copy) noexcept
 {
 	this->_Count = copy._Count;
-	if (this->_Count > 0)
-		std::memcpy(this->_Array, copy._Array, Datasize(this->_Count));
+	for (i64 i = 0; i < this->_Count; i++)
+		this->_Array[i] = copy._Array[i];
+	return *this;
 }
 
-Array& operator = (Array&& move) noexcept
+constexpr _ArrayStorage& operator = (_ArrayStorage&& move) noexcept
 {
+	if (this == &move)
+		return *this;
 	this->_Count = move._Count;
 	if (this->_Count >= 0)
 	{
-		if (this->_Count > 0)
-			std::memcpy(this->_Array, move._Array, Datasize(this->_Count));
-		std::memset(move._Array, 0, Datasize(move._Count));
+		for (i64 i = 0; i < this->_Count; i++)
+		{
+			this->_Array[i] = (Datatype&&)(move._Array[i]);
+			move._Array[i] = Datatype {};
+		}
 		move._Count = -1;
 	}
+	return *this;
+}
+
+};
+
+/// NOTE: Array is a literal type whenever Datatype is, so everything except Sort() & StableSort() also works in
+/// constant expressions, e.g. a lookup table can be built by a constexpr function & stored in read-only memory.
+/// HeapSort() is the constexpr sort.
+template <typename Datatype, i64 _Capacity>
+class Array : private _ArrayStorage<Datatype, _Capacity>
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	using _ArrayStorage<Datatype, _Capacity>::_Array;
+	using _ArrayStorage<Datatype, _Capacity>::_Count;
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+constexpr Array() noexcept = default;
+
+~Array() noexcept = default;
+
+////////////////////////////////////////////////////////////////////////////////
+/// OVERLOADED CONSTRUCTORS
+public:
+
+constexpr explicit Array(const i64 init_count, const Datatype* const init_array) noexcept
+{
+	this->_Count = init_count;
+	if (( this->_Count > 0 )&&
+		( init_array != nullptr ))
+		_Copy(this->_Array, init_array, this->_Count);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
+public:
+
+/// NOTE: see _ArrayStorage, moving an Array of trivially copyable elements copies it
+constexpr Array(const Array& copy) noexcept = default;
+constexpr Array(Array&& move) noexcept = default;
+constexpr Array& operator = (const Array& copy) noexcept = default;
+constexpr Array& operator = (Array&& move) noexcept = default;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// SIZE & CAPACITY ACCESSORS
 public:
 
-u64 Datasize(const u64 num = 1) const noexcept
+constexpr u64 Datasize(const u64 num = 1) const noexcept
 {
 	return sizeof(Datatype) * num;
 }
 
-i64 Count(void) const noexcept
+constexpr i64 Count(void) const noexcept
 {
 	return _Count;
 }
 
-i64 Capacity(void) const noexcept
+constexpr i64 Capacity(void) const noexcept
 {
 	return _Capacity;
 }
 
-bool Empty(void) const noexcept
+constexpr bool Empty(void) const noexcept
 {
 	return (_Count == 0);
 }
 
-bool Full(void) const noexcept
+constexpr bool Full(void) const noexcept
 {
 	return (_Count == _Capacity);
 }
@@ -145,33 +214,44 @@ bool Full(void) const noexcept
 /// MEMORY ACCESSORS & MODIFIERS
 public:
 
-const Datatype& At(const i64 index) const
+constexpr const Datatype& At(const i64 index) const
 {
 	if (index < 0 || _Count <= index)
 		throw alt::InvalidIndex();
 	return _Array[index];
 }
 
-Datatype& At(const i64 index)
+constexpr Datatype& At(const i64 index)
 {
 	if (index < 0 || _Count <= index)
 		throw alt::InvalidIndex();
 	return _Array[index];
 }
 
-const Datatype& operator [] (const i64 index) const noexcept
+constexpr const Datatype& operator [] (const i64 index) const noexcept
 {
 	return _Array[index];
 }
 
+constexpr const Datatype* Data(void) const noexcept
+{
+	return _Array;
+}
+
+/// WARN: this method can destroy the _Count invariant
+constexpr Datatype* Data(void) noexcept
+{
+	return _Array;
+}
+
 /// WARN: this method can destroy the _Count invariant
-Datatype& operator [] (const i64 index) noexcept
+constexpr Datatype& operator [] (const i64 index) noexcept
 {
 	return _Array[index];
 }
 
 /// NOTE: includes bounds checking, and cannot destroy the _Count invariant
-bool Swap(const i64 index1st, const i64 index2nd) noexcept
+constexpr bool Swap(const i64 index1st, const i64 index2nd) noexcept
 {
 	if (( index1st < 0 || _Count <= index1st )||
 		( index2nd < 0 || _Count <= index2nd ))
@@ -181,7 +261,7 @@ bool Swap(const i64 index1st, const i64 index2nd) noexcept
 }
 
 /// NOTE: includes bounds checking, and cannot destroy the _Count invariant
-bool Swap(Datatype* const ptr1st, Datatype* const ptr2nd) noexcept
+constexpr bool Swap(Datatype* const ptr1st, Datatype* const ptr2nd) noexcept
 {
 	if ((ptr1st == nullptr)||
 		(ptr2nd == nullptr))
@@ -202,18 +282,30 @@ bool Swap(Datatype* const ptr1st, Datatype* const ptr2nd) noexcept
 private:
 
 /// WARN: this method can destroy the _Count invariant
-void _Swap(Datatype* const ptr1st, Datatype* const ptr2nd) noexcept
+constexpr void _Swap(Datatype* const ptr1st, Datatype* const ptr2nd) noexcept
 {
 	Datatype tmp = *ptr1st;
 	*ptr1st      = *ptr2nd;
 	*ptr2nd      = tmp;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// COPY HELPER METHOD
+private:
+
+/// NOTE: an element-wise loop rather than std::memcpy() so that it can run in constant expressions, compilers lower it
+/// to the same block copy at run time
+static constexpr void _Copy(Datatype* const dst, const Datatype* const src, const i64 count) noexcept
+{
+	for (i64 i = 0; i < count; i++)
+		dst[i] = src[i];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// SEARCH METHODS
 public:
 
-bool Contains(const Datatype& x) const noexcept
+constexpr bool Contains(const Datatype& x) const noexcept
 {
 	const Datatype* ptr = _Array;
 	const Datatype* const end = ptr + _Count;
@@ -223,7 +315,7 @@ bool Contains(const Datatype& x) const noexcept
 	return false;
 }
 
-i64 IndexOf(const Datatype& x) const noexcept
+constexpr i64 IndexOf(const Datatype& x) const noexcept
 {
 	const Datatype* ptr = _Array;
 	for (i64 i = 0; i < _Count; ptr++, i++)
@@ -232,7 +324,7 @@ i64 IndexOf(const Datatype& x) const noexcept
 	return -1;
 }
 
-i64 LastIndexOf(const Datatype& x) const noexcept
+constexpr i64 LastIndexOf(const Datatype& x) const noexcept
 {
 	const Datatype* ptr = _Array + (_Count - 1);
 	for (i64 i = _Count - 1; i >= 0; ptr--, i--)
@@ -241,11 +333,57 @@ i64 LastIndexOf(const Datatype& x) const noexcept
 	return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// SORTING METHODS
+public:
+
+/// NOTE: integral, floating point, & alt::u128 elements are radix sorted, everything else is pattern-defeating
+/// quicksorted using operator <
+void Sort(void) noexcept
+{
+	alt::Sort(_Array, _Count);
+}
+
+template <class Compare>
+void Sort(Compare less) noexcept
+{
+	alt::Sort(_Array, _Count, less);
+}
+
+/// NOTE: returns true if the scratch buffer could not be allocated, in which case the Array is left untouched
+bool StableSort(void) noexcept
+{
+	return alt::StableSort(_Array, _Count);
+}
+
+template <class Compare>
+bool StableSort(Compare less) noexcept
+{
+	return alt::StableSort(_Array, _Count, less);
+}
+
+/// NOTE: unstable & O(n log n), unlike Sort() it works in constant expressions
+constexpr void HeapSort(void) noexcept
+{
+	alt::HeapSort(_Array, _Count);
+}
+
+template <class Compare>
+constexpr void HeapSort(Compare less) noexcept
+{
+	alt::HeapSort(_Array, _Count, less);
+}
+
+constexpr bool IsSorted(void) const noexcept
+{
+	return alt::IsSorted(_Array, _Count);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// CONTAINER METHODS
 public:
 
-bool Get(u32 index, Datatype& rtn) noexcept
+constexpr bool Get(u32 index, Datatype& rtn) noexcept
 {
 	if (index < 0 || _Count <= index)
 		return true;
@@ -253,7 +391,7 @@ bool Get(u32 index, Datatype& rtn) noexcept
 	return Remove(index);
 }
 
-bool Push(const Datatype& x) noexcept
+constexpr bool Push(const Datatype& x) noexcept
 {
 	if (Full())
 		return true;
@@ -266,7 +404,7 @@ bool Push(const Datatype& x) noexcept
 	return false;
 }
 
-bool Enqueue(const Datatype& x) noexcept
+constexpr bool Enqueue(const Datatype& x) noexcept
 {
 	if (Full())
 		return true;
@@ -274,43 +412,53 @@ bool Enqueue(const Datatype& x) noexcept
 	return false;
 }
 
-bool operator += (const Datatype& x) noexcept
+constexpr bool operator += (const Datatype& x) noexcept
 {
 	return Enqueue(x);
 }
 
-const Datatype& Peek(void) const
+/// NOTE: appends 'count' elements without assigning them, for callers which fill them in place (e.g. alt::Load()),
+/// returns true if they don't fit
+constexpr bool Extend(const i64 count) noexcept
+{
+	if (count < 0 || _Capacity - _Count < count)
+		return true;
+	_Count += count;
+	return false;
+}
+
+constexpr const Datatype& Peek(void) const
 {
 	return At(0);
 }
 
-Datatype& Peek(void)
+constexpr Datatype& Peek(void)
 {
 	return At(0);
 }
 
-const Datatype& PeekBack(void) const
+constexpr const Datatype& PeekBack(void) const
 {
 	return At(_Count - 1);
 }
 
-Datatype& PeekBack(void)
+constexpr Datatype& PeekBack(void)
 {
 	return At(_Count - 1);
 }
 
-bool Pop(Datatype& rtn) noexcept
+constexpr bool Pop(Datatype& rtn) noexcept
 {
 	return Get(0, rtn);
 }
 
-bool PopBack(Datatype& rtn) noexcept
+constexpr bool PopBack(Datatype& rtn) noexcept
 {
 	return Get(_Count - 1, rtn);
 }
 
 /// NOTE: index can be within the range [0, _Count], otherwise this method fails and returns true
-bool Insert(u32 index, const Datatype& x) noexcept
+constexpr bool Insert(u32 index, const Datatype& x) noexcept
 {
 	if (Full())
 		return true;
@@ -325,7 +473,7 @@ bool Insert(u32 index, const Datatype& x) noexcept
 	return false;
 }
 
-bool Remove(const i64 index) noexcept
+constexpr bool Remove(const i64 index) noexcept
 {
 	if (index < 0 || _Count <= index)
 		return true;
@@ -337,7 +485,7 @@ bool Remove(const i64 index) noexcept
 	return false;
 }
 
-void Erase(void) noexcept
+constexpr void Erase(void) noexcept
 {
 	_Count = 0;
 }
@@ -346,7 +494,7 @@ void Erase(void) noexcept
 /// ARRAY OPERATION METHODS
 public:
 
-bool Equals(const Array& that) const noexcept
+constexpr bool Equals(const Array& that) const noexcept
 {
 	if (this->_Count != that._Count)
 		return false;
@@ -359,13 +507,13 @@ bool Equals(const Array& that) const noexcept
 	return true;
 }
 
-bool operator == (const Array& that) const noexcept
+constexpr bool operator == (const Array& that) const noexcept
 {
 	return this->Equals(that);
 }
 
 /// NOTE: returns the opposite of operator ==
-bool operator != (const Array& that) const noexcept
+constexpr bool operator != (const Array& that) const noexcept
 {
 	return ! this->operator == (that);
 }
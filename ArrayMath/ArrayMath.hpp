@@ -0,0 +1,615 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef ARRAYMATH_HPP
+#define ARRAYMATH_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Array.hpp"
+
+#include <type_traits> // exclusively for std::is_arithmetic & std::is_floating_point
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ALT_ARRAYMATH_SSE2
+#include <immintrin.h> // exclusively for the SSE & AVX intrinsics
+#endif
+
+namespace alt // ArrayMath belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: elementwise arithmetic, fused multiply-add, dot products, horizontal reductions, & comparisons for Arrays of
+/// arithmetic elements.  Every operation works on the first min(Count()) elements of its operands, a register's
+/// worth at a time through SimdLanes, then finishes the remainder one element at a time.
+///
+/// NOTE: SimdLanes is specialized with SSE2 for f32 & f64, with AVX when the translation unit is compiled for it, &
+/// with fused multiply-adds when it's compiled for FMA.  i32 uses SSE4.1 or AVX2 when they're available.  Every other
+/// element type (& integer division) runs plain loops over raw pointers, which compilers vectorize on their own.
+///
+/// NOTE: a default x86-64 build only has SSE2, so it gets the 4 & 2 lane f32 & f64 kernels & scalar i32.  Configure
+/// with -DALT_ARRAYMATH_AVX2=ON (which adds -mavx2 -mfma, or /arch:AVX2) to get the 8 & 4 lane kernels, AVX2 i32, &
+/// FMA.  Array's storage alignment doesn't depend on these flags, so translation units built with & without them can
+/// still share Arrays.
+template <typename Datatype, typename Enable = void>
+class SimdLanes
+{
+public:
+
+READONLY bool Enabled = false;
+READONLY u32  Width   = 1;
+
+};
+
+#if defined(ALT_ARRAYMATH_SSE2)
+
+template <>
+class SimdLanes<f32>
+{
+public:
+
+READONLY bool Enabled = true;
+
+#if defined(__AVX__)
+
+READONLY u32 Width = 8;
+using Register = __m256;
+
+static Register Load(const f32* const p) noexcept                      { return _mm256_loadu_ps(p); }
+static Register Broadcast(const f32 x) noexcept                        { return _mm256_set1_ps(x); }
+static void Store(f32* const p, const Register x) noexcept             { _mm256_storeu_ps(p, x); }
+static Register Add(const Register x, const Register y) noexcept       { return _mm256_add_ps(x, y); }
+static Register Sub(const Register x, const Register y) noexcept       { return _mm256_sub_ps(x, y); }
+static Register Mul(const Register x, const Register y) noexcept       { return _mm256_mul_ps(x, y); }
+static Register Div(const Register x, const Register y) noexcept       { return _mm256_div_ps(x, y); }
+static Register Min(const Register x, const Register y) noexcept       { return _mm256_min_ps(x, y); }
+static Register Max(const Register x, const Register y) noexcept       { return _mm256_max_ps(x, y); }
+static u32 LessMask(const Register x, const Register y) noexcept
+{
+	return (u32)(_mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_LT_OQ)));
+}
+static u32 EqualMask(const Register x, const Register y) noexcept
+{
+	return (u32)(_mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_EQ_OQ)));
+}
+#if defined(__FMA__)
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return _mm256_fmadd_ps(x, y, z); }
+#else
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return Add(Mul(x, y), z); }
+#endif
+
+#else
+
+READONLY u32 Width = 4;
+using Register = __m128;
+
+static Register Load(const f32* const p) noexcept                      { return _mm_loadu_ps(p); }
+static Register Broadcast(const f32 x) noexcept                        { return _mm_set1_ps(x); }
+static void Store(f32* const p, const Register x) noexcept             { _mm_storeu_ps(p, x); }
+static Register Add(const Register x, const Register y) noexcept       { return _mm_add_ps(x, y); }
+static Register Sub(const Register x, const Register y) noexcept       { return _mm_sub_ps(x, y); }
+static Register Mul(const Register x, const Register y) noexcept       { return _mm_mul_ps(x, y); }
+static Register Div(const Register x, const Register y) noexcept       { return _mm_div_ps(x, y); }
+static Register Min(const Register x, const Register y) noexcept       { return _mm_min_ps(x, y); }
+static Register Max(const Register x, const Register y) noexcept       { return _mm_max_ps(x, y); }
+static u32 LessMask(const Register x, const Register y) noexcept       { return (u32)(_mm_movemask_ps(_mm_cmplt_ps(x, y))); }
+static u32 EqualMask(const Register x, const Register y) noexcept      { return (u32)(_mm_movemask_ps(_mm_cmpeq_ps(x, y))); }
+#if defined(__FMA__)
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return _mm_fmadd_ps(x, y, z); }
+#else
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return Add(Mul(x, y), z); }
+#endif
+
+#endif
+
+};
+
+template <>
+class SimdLanes<f64>
+{
+public:
+
+READONLY bool Enabled = true;
+
+#if defined(__AVX__)
+
+READONLY u32 Width = 4;
+using Register = __m256d;
+
+static Register Load(const f64* const p) noexcept                      { return _mm256_loadu_pd(p); }
+static Register Broadcast(const f64 x) noexcept                        { return _mm256_set1_pd(x); }
+static void Store(f64* const p, const Register x) noexcept             { _mm256_storeu_pd(p, x); }
+static Register Add(const Register x, const Register y) noexcept       { return _mm256_add_pd(x, y); }
+static Register Sub(const Register x, const Register y) noexcept       { return _mm256_sub_pd(x, y); }
+static Register Mul(const Register x, const Register y) noexcept       { return _mm256_mul_pd(x, y); }
+static Register Div(const Register x, const Register y) noexcept       { return _mm256_div_pd(x, y); }
+static Register Min(const Register x, const Register y) noexcept       { return _mm256_min_pd(x, y); }
+static Register Max(const Register x, const Register y) noexcept       { return _mm256_max_pd(x, y); }
+static u32 LessMask(const Register x, const Register y) noexcept
+{
+	return (u32)(_mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_LT_OQ)));
+}
+static u32 EqualMask(const Register x, const Register y) noexcept
+{
+	return (u32)(_mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_EQ_OQ)));
+}
+#if defined(__FMA__)
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return _mm256_fmadd_pd(x, y, z); }
+#else
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return Add(Mul(x, y), z); }
+#endif
+
+#else
+
+READONLY u32 Width = 2;
+using Register = __m128d;
+
+static Register Load(const f64* const p) noexcept                      { return _mm_loadu_pd(p); }
+static Register Broadcast(const f64 x) noexcept                        { return _mm_set1_pd(x); }
+static void Store(f64* const p, const Register x) noexcept             { _mm_storeu_pd(p, x); }
+static Register Add(const Register x, const Register y) noexcept       { return _mm_add_pd(x, y); }
+static Register Sub(const Register x, const Register y) noexcept       { return _mm_sub_pd(x, y); }
+static Register Mul(const Register x, const Register y) noexcept       { return _mm_mul_pd(x, y); }
+static Register Div(const Register x, const Register y) noexcept       { return _mm_div_pd(x, y); }
+static Register Min(const Register x, const Register y) noexcept       { return _mm_min_pd(x, y); }
+static Register Max(const Register x, const Register y) noexcept       { return _mm_max_pd(x, y); }
+static u32 LessMask(const Register x, const Register y) noexcept       { return (u32)(_mm_movemask_pd(_mm_cmplt_pd(x, y))); }
+static u32 EqualMask(const Register x, const Register y) noexcept      { return (u32)(_mm_movemask_pd(_mm_cmpeq_pd(x, y))); }
+#if defined(__FMA__)
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return _mm_fmadd_pd(x, y, z); }
+#else
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return Add(Mul(x, y), z); }
+#endif
+
+#endif
+
+};
+
+#if defined(__AVX2__)
+
+template <>
+class SimdLanes<i32>
+{
+public:
+
+READONLY bool Enabled = true;
+READONLY u32  Width   = 8;
+using Register = __m256i;
+
+static Register Load(const i32* const p) noexcept                      { return _mm256_loadu_si256((const __m256i*)(p)); }
+static Register Broadcast(const i32 x) noexcept                        { return _mm256_set1_epi32(x); }
+static void Store(i32* const p, const Register x) noexcept             { _mm256_storeu_si256((__m256i*)(p), x); }
+static Register Add(const Register x, const Register y) noexcept       { return _mm256_add_epi32(x, y); }
+static Register Sub(const Register x, const Register y) noexcept       { return _mm256_sub_epi32(x, y); }
+static Register Mul(const Register x, const Register y) noexcept       { return _mm256_mullo_epi32(x, y); }
+static Register Min(const Register x, const Register y) noexcept       { return _mm256_min_epi32(x, y); }
+static Register Max(const Register x, const Register y) noexcept       { return _mm256_max_epi32(x, y); }
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return Add(Mul(x, y), z); }
+static u32 LessMask(const Register x, const Register y) noexcept
+{
+	return (u32)(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(y, x))));
+}
+static u32 EqualMask(const Register x, const Register y) noexcept
+{
+	return (u32)(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, y))));
+}
+
+};
+
+#elif defined(__SSE4_1__)
+
+template <>
+class SimdLanes<i32>
+{
+public:
+
+READONLY bool Enabled = true;
+READONLY u32  Width   = 4;
+using Register = __m128i;
+
+static Register Load(const i32* const p) noexcept                      { return _mm_loadu_si128((const __m128i*)(p)); }
+static Register Broadcast(const i32 x) noexcept                        { return _mm_set1_epi32(x); }
+static void Store(i32* const p, const Register x) noexcept             { _mm_storeu_si128((__m128i*)(p), x); }
+static Register Add(const Register x, const Register y) noexcept       { return _mm_add_epi32(x, y); }
+static Register Sub(const Register x, const Register y) noexcept       { return _mm_sub_epi32(x, y); }
+static Register Mul(const Register x, const Register y) noexcept       { return _mm_mullo_epi32(x, y); }
+static Register Min(const Register x, const Register y) noexcept       { return _mm_min_epi32(x, y); }
+static Register Max(const Register x, const Register y) noexcept       { return _mm_max_epi32(x, y); }
+static Register Fma(const Register x, const Register y, const Register z) noexcept { return Add(Mul(x, y), z); }
+static u32 LessMask(const Register x, const Register y) noexcept
+{
+	return (u32)(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x, y))));
+}
+static u32 EqualMask(const Register x, const Register y) noexcept
+{
+	return (u32)(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, y))));
+}
+
+};
+
+#endif // i32
+
+#endif // ALT_ARRAYMATH_SSE2
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// KERNELS
+
+/// NOTE: each operation is a class with a Vector() step over SimdLanes registers & a Scalar() step over single
+/// elements.  Vector() is a template on the lanes, so it's never instantiated for element types without them.
+class _ArrayAdd
+{
+public:
+template <class Lanes, typename Register>
+static Register Vector(const Register x, const Register y) noexcept { return Lanes::Add(x, y); }
+template <typename Datatype>
+static Datatype Scalar(const Datatype x, const Datatype y) noexcept { return (Datatype)(x + y); }
+};
+
+class _ArraySub
+{
+public:
+template <class Lanes, typename Register>
+static Register Vector(const Register x, const Register y) noexcept { return Lanes::Sub(x, y); }
+template <typename Datatype>
+static Datatype Scalar(const Datatype x, const Datatype y) noexcept { return (Datatype)(x - y); }
+};
+
+class _ArrayMul
+{
+public:
+template <class Lanes, typename Register>
+static Register Vector(const Register x, const Register y) noexcept { return Lanes::Mul(x, y); }
+template <typename Datatype>
+static Datatype Scalar(const Datatype x, const Datatype y) noexcept { return (Datatype)(x * y); }
+};
+
+class _ArrayDiv
+{
+public:
+template <class Lanes, typename Register>
+static Register Vector(const Register x, const Register y) noexcept { return Lanes::Div(x, y); }
+template <typename Datatype>
+static Datatype Scalar(const Datatype x, const Datatype y) noexcept { return (Datatype)(x / y); }
+};
+
+class _ArrayMin
+{
+public:
+template <class Lanes, typename Register>
+static Register Vector(const Register x, const Register y) noexcept { return Lanes::Min(x, y); }
+template <typename Datatype>
+static Datatype Scalar(const Datatype x, const Datatype y) noexcept { return x < y ? x : y; }
+};
+
+class _ArrayMax
+{
+public:
+template <class Lanes, typename Register>
+static Register Vector(const Register x, const Register y) noexcept { return Lanes::Max(x, y); }
+template <typename Datatype>
+static Datatype Scalar(const Datatype x, const Datatype y) noexcept { return y < x ? x : y; }
+};
+
+/// NOTE: the dot product folds a * b into its lanes, the horizontal reductions fold a alone with the same operation
+/// they use to combine the lanes at the end
+class _ArrayDot
+{
+public:
+template <class Lanes, typename Register>
+static Register First(const Register x, const Register y) noexcept { return Lanes::Mul(x, y); }
+template <class Lanes, typename Register>
+static Register Step(const Register x, const Register y, const Register sum) noexcept { return Lanes::Fma(x, y, sum); }
+template <typename Datatype>
+static Datatype Combine(const Datatype sum, const Datatype lane) noexcept { return (Datatype)(sum + lane); }
+template <typename Datatype>
+static Datatype Scalar(const Datatype sum, const Datatype x, const Datatype y) noexcept { return (Datatype)(sum + x * y); }
+};
+
+template <class Operation>
+class _ArrayReduce
+{
+public:
+template <class Lanes, typename Register>
+static Register First(const Register x, const Register) noexcept { return x; }
+template <class Lanes, typename Register>
+static Register Step(const Register x, const Register, const Register sum) noexcept
+{
+	return Operation::template Vector<Lanes>(x, sum);
+}
+template <typename Datatype>
+static Datatype Combine(const Datatype sum, const Datatype lane) noexcept { return Operation::Scalar(sum, lane); }
+template <typename Datatype>
+static Datatype Scalar(const Datatype sum, const Datatype x, const Datatype) noexcept
+{
+	return Operation::Scalar(sum, x);
+}
+};
+
+/// NOTE: out[i] = Operation(a[i], b[i]) a register at a time, then an element at a time for the rest
+template <class Operation, typename Datatype>
+void _ArrayZip(Datatype* const out, const Datatype* const a, const Datatype* const b, const i64 count) noexcept
+{
+	using Lanes = SimdLanes<Datatype>;
+	i64 i = 0;
+	if constexpr (Lanes::Enabled)
+		for (; i + Lanes::Width <= count; i += Lanes::Width)
+			Lanes::Store(out + i, Operation::template Vector<Lanes>(Lanes::Load(a + i), Lanes::Load(b + i)));
+	for (; i < count; i++)
+		out[i] = Operation::Scalar(a[i], b[i]);
+}
+
+/// NOTE: out[i] = Operation(a[i], x), with 'x' broadcast into a register once up front
+template <class Operation, typename Datatype>
+void _ArrayZipScalar(Datatype* const out, const Datatype* const a, const Datatype x, const i64 count) noexcept
+{
+	using Lanes = SimdLanes<Datatype>;
+	i64 i = 0;
+	if constexpr (Lanes::Enabled)
+	{
+		const typename Lanes::Register broadcast = Lanes::Broadcast(x);
+		for (; i + Lanes::Width <= count; i += Lanes::Width)
+			Lanes::Store(out + i, Operation::template Vector<Lanes>(Lanes::Load(a + i), broadcast));
+	}
+	for (; i < count; i++)
+		out[i] = Operation::Scalar(a[i], x);
+}
+
+/// NOTE: folds a register at a time into 'Width' running lanes, combines the lanes, then folds in the rest
+template <class Operation, typename Datatype>
+Datatype _ArrayFold(const Datatype* const a, const Datatype* const b, const i64 count, const Datatype initial) noexcept
+{
+	using Lanes = SimdLanes<Datatype>;
+	i64 i = 0;
+	Datatype rtn = initial;
+	if constexpr (Lanes::Enabled)
+		if (count >= Lanes::Width)
+		{
+			typename Lanes::Register lanes = Operation::template First<Lanes>(Lanes::Load(a), Lanes::Load(b));
+			for (i = Lanes::Width; i + Lanes::Width <= count; i += Lanes::Width)
+				lanes = Operation::template Step<Lanes>(Lanes::Load(a + i), Lanes::Load(b + i), lanes);
+			Datatype spill[Lanes::Width];
+			Lanes::Store(spill, lanes);
+			rtn = spill[0];
+			for (u32 lane = 1; lane < Lanes::Width; lane++)
+				rtn = Operation::Combine(rtn, spill[lane]);
+		}
+	for (; i < count; i++)
+		rtn = Operation::Scalar(rtn, a[i], b[i]);
+	return rtn;
+}
+
+/// NOTE: out[i] = whether a[i] < b[i] (or a[i] == b[i] if 'equal'), a register at a time through a lane mask
+template <typename Datatype, i64 _Capacity>
+Array<bool, _Capacity> _ArrayCompare(const Datatype* const a, const Datatype* const b, const i64 count,
+                                      const bool equal) noexcept
+{
+	using Lanes = SimdLanes<Datatype>;
+	Array<bool, _Capacity> rtn;
+	rtn.Extend(count);
+	bool* const out = rtn.Data();
+	i64 i = 0;
+	if constexpr (Lanes::Enabled)
+		for (; i + Lanes::Width <= count; i += Lanes::Width)
+		{
+			const u32 mask = equal ? Lanes::EqualMask(Lanes::Load(a + i), Lanes::Load(b + i))
+			                       : Lanes::LessMask(Lanes::Load(a + i), Lanes::Load(b + i));
+			for (u32 lane = 0; lane < Lanes::Width; lane++)
+				out[i + lane] = (mask >> lane) & 1;
+		}
+	for (; i < count; i++)
+		out[i] = equal ? a[i] == b[i] : a[i] < b[i];
+	return rtn;
+}
+
+template <typename Datatype, i64 _Capacity>
+i64 _ArrayCount(const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	static_assert(std::is_arithmetic<Datatype>::value, "alt::Array math requires arithmetic elements");
+	return a.Count() < b.Count() ? a.Count() : b.Count();
+}
+
+/// NOTE: the shared body of the elementwise operations, the result holds min(a.Count(), b.Count()) elements
+template <class Operation, typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> _ArrayElementwise(const Array<Datatype, _Capacity>& a,
+                                             const Array<Datatype, _Capacity>& b) noexcept
+{
+	const i64 count = _ArrayCount(a, b);
+	Array<Datatype, _Capacity> rtn;
+	rtn.Extend(count);
+	_ArrayZip<Operation>(rtn.Data(), a.Data(), b.Data(), count);
+	return rtn;
+}
+
+/// NOTE: the shared body of the scalar overloads, the result holds a.Count() elements
+template <class Operation, typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> _ArrayElementwise(const Array<Datatype, _Capacity>& a, const Datatype x) noexcept
+{
+	const i64 count = _ArrayCount(a, a);
+	Array<Datatype, _Capacity> rtn;
+	rtn.Extend(count);
+	_ArrayZipScalar<Operation>(rtn.Data(), a.Data(), x, count);
+	return rtn;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// ELEMENTWISE ARITHMETIC
+
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> operator + (const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayElementwise<_ArrayAdd>(a, b);
+}
+
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> operator - (const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayElementwise<_ArraySub>(a, b);
+}
+
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> operator * (const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayElementwise<_ArrayMul>(a, b);
+}
+
+/// WARN: integer elements are divided one at a time, & dividing one by zero is undefined as usual
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> operator / (const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	if constexpr (std::is_floating_point<Datatype>::value)
+		return _ArrayElementwise<_ArrayDiv>(a, b);
+	else
+	{
+		const i64 count = _ArrayCount(a, b);
+		Array<Datatype, _Capacity> rtn;
+		rtn.Extend(count);
+		for (i64 i = 0; i < count; i++)
+			rtn[i] = _ArrayDiv::Scalar(a[i], b[i]);
+		return rtn;
+	}
+}
+
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> operator + (const Array<Datatype, _Capacity>& a, const Datatype x) noexcept
+{
+	return _ArrayElementwise<_ArrayAdd>(a, x);
+}
+
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> operator - (const Array<Datatype, _Capacity>& a, const Datatype x) noexcept
+{
+	return _ArrayElementwise<_ArraySub>(a, x);
+}
+
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> operator * (const Array<Datatype, _Capacity>& a, const Datatype x) noexcept
+{
+	return _ArrayElementwise<_ArrayMul>(a, x);
+}
+
+/// WARN: as above, integer elements are divided one at a time
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> operator / (const Array<Datatype, _Capacity>& a, const Datatype x) noexcept
+{
+	if constexpr (std::is_floating_point<Datatype>::value)
+		return _ArrayElementwise<_ArrayDiv>(a, x);
+	else
+	{
+		Array<Datatype, _Capacity> rtn;
+		rtn.Extend(a.Count());
+		for (i64 i = 0; i < a.Count(); i++)
+			rtn[i] = _ArrayDiv::Scalar(a[i], x);
+		return rtn;
+	}
+}
+
+/// NOTE: a * b + c, rounded once where the target has fused multiply-adds
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> Fma(const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b,
+                               const Array<Datatype, _Capacity>& c) noexcept
+{
+	using Lanes = SimdLanes<Datatype>;
+	const i64 ab    = _ArrayCount(a, b);
+	const i64 count = ab < c.Count() ? ab : c.Count();
+	Array<Datatype, _Capacity> rtn;
+	rtn.Extend(count);
+	Datatype* const out = rtn.Data();
+	i64 i = 0;
+	if constexpr (Lanes::Enabled)
+		for (; i + Lanes::Width <= count; i += Lanes::Width)
+			Lanes::Store(out + i, Lanes::Fma(Lanes::Load(a.Data() + i), Lanes::Load(b.Data() + i),
+			                                 Lanes::Load(c.Data() + i)));
+	for (; i < count; i++)
+		out[i] = (Datatype)(a[i] * b[i] + c[i]);
+	return rtn;
+}
+
+/// NOTE: the elementwise minimum & maximum
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> Min(const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayElementwise<_ArrayMin>(a, b);
+}
+
+template <typename Datatype, i64 _Capacity>
+Array<Datatype, _Capacity> Max(const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayElementwise<_ArrayMax>(a, b);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// REDUCTIONS
+
+/// NOTE: accumulates in 'Width' independent lanes, so floating point results may differ from a left to right sum in
+/// the last bits
+template <typename Datatype, i64 _Capacity>
+Datatype Dot(const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayFold<_ArrayDot>(a.Data(), b.Data(), _ArrayCount(a, b), (Datatype)(0));
+}
+
+template <typename Datatype, i64 _Capacity>
+Datatype Sum(const Array<Datatype, _Capacity>& a) noexcept
+{
+	return _ArrayFold<_ArrayReduce<_ArrayAdd>>(a.Data(), a.Data(), _ArrayCount(a, a), (Datatype)(0));
+}
+
+/// NOTE: the smallest & largest element, or zero if 'a' is empty
+template <typename Datatype, i64 _Capacity>
+Datatype Min(const Array<Datatype, _Capacity>& a) noexcept
+{
+	return _ArrayFold<_ArrayReduce<_ArrayMin>>(a.Data(), a.Data(), _ArrayCount(a, a), a.Empty() ? (Datatype)(0) : a[0]);
+}
+
+template <typename Datatype, i64 _Capacity>
+Datatype Max(const Array<Datatype, _Capacity>& a) noexcept
+{
+	return _ArrayFold<_ArrayReduce<_ArrayMax>>(a.Data(), a.Data(), _ArrayCount(a, a), a.Empty() ? (Datatype)(0) : a[0]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// COMPARISONS
+
+/// NOTE: elementwise comparisons, the result holds min(a.Count(), b.Count()) elements
+template <typename Datatype, i64 _Capacity>
+Array<bool, _Capacity> LessThan(const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayCompare<Datatype, _Capacity>(a.Data(), b.Data(), _ArrayCount(a, b), false);
+}
+
+template <typename Datatype, i64 _Capacity>
+Array<bool, _Capacity> GreaterThan(const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayCompare<Datatype, _Capacity>(b.Data(), a.Data(), _ArrayCount(a, b), false);
+}
+
+template <typename Datatype, i64 _Capacity>
+Array<bool, _Capacity> EqualTo(const Array<Datatype, _Capacity>& a, const Array<Datatype, _Capacity>& b) noexcept
+{
+	return _ArrayCompare<Datatype, _Capacity>(a.Data(), b.Data(), _ArrayCount(a, b), true);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end ARRAYMATH_HPP
@@ -0,0 +1,309 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+/// NOTE: configure with -DCMAKE_BUILD_TYPE=Release, unoptimized timings are meaningless
+
+#include <algorithm> // exclusively for std::sort()
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+
+#include "Exceptions.hpp"
+
+#include "Allocator.hpp"
+
+#include "Sort.hpp"
+
+#include "Vector.hpp"
+#include "MpmcQueue.hpp"
+#include "EytzingerIndex.hpp"
+
+#include "u128.hpp"
+
+READONLY STR INFO = "INFO:   ";
+READONLY STR EXIT = "EXIT:   ";
+
+READONLY alt::u32 SORT_BENCH_COUNT      = 1000000;
+READONLY alt::u64 QUEUE_BENCH_COUNT     = 1 << 20;
+READONLY alt::u64 QUEUE_BENCH_CAPACITY  = 1024;
+READONLY alt::u64 QUEUE_LATENCY_SAMPLES = 16;   // every 16th element a consumer pops is timed
+READONLY alt::u64 QUEUE_POP_BATCH       = 64;   // consumers add their pops to the shared count 64 at a time
+READONLY alt::u32 SEARCH_BENCH_QUERIES  = 1 << 22;
+
+void BenchSort      ( void );
+void BenchMpmcQueue ( void );
+void BenchSearch    ( void );
+
+int main(const int argc, const STR const argv[], const STR const envp[])
+{
+    std::cout << std::endl;
+    try
+    {
+        BenchSort();
+        BenchMpmcQueue();
+        BenchSearch();
+    }
+    catch (const alt::Except& err)
+    {
+        std::cout << EXIT << "FAILURE" << std::endl << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << EXIT << "SUCCESS" << std::endl << std::endl;
+    return EXIT_SUCCESS;
+}
+
+alt::u64 Random(void)
+{
+    static alt::u64 seed = 88172645463325252ull;
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+/// NOTE: returns the milliseconds 'sort' takes to sort a fresh copy of 'input' into 'scratch'
+template <typename Datatype, class Sorter>
+double TimeSort(const Datatype* const input, Datatype* const scratch, const alt::u32 count, Sorter sort)
+{
+    std::memcpy(scratch, input, sizeof(Datatype) * count);
+    const auto start = std::chrono::steady_clock::now();
+    sort(scratch, count);
+    const auto stop = std::chrono::steady_clock::now();
+    if (! alt::IsSorted(scratch, count))
+        throw alt::Except { "unsorted benchmark output" };
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <typename Datatype>
+void BenchSortPattern(const STR const type, const STR const pattern, const Datatype* const input, const alt::u32 count)
+{
+    alt::Allocator<Datatype> allocator;
+    Datatype* scratch = allocator.Allocate(count);
+
+    const double stdSort = TimeSort(input, scratch, count, [](Datatype* base, alt::u32 n)
+        { std::sort(base, base + n); });
+    const double altSort = TimeSort(input, scratch, count, [](Datatype* base, alt::u32 n)
+        { alt::Sort(base, n); });
+    const double pdqSort = TimeSort(input, scratch, count, [](Datatype* base, alt::u32 n)
+        { alt::Sort(base, n, alt::Less<Datatype> {}); });
+    const double stable  = TimeSort(input, scratch, count, [](Datatype* base, alt::u32 n)
+        { alt::StableSort(base, n, alt::Less<Datatype> {}); });
+
+    std::cout << INFO << std::left << std::setw(6) << type << std::setw(12) << pattern << std::right << std::fixed
+              << std::setprecision(2)
+              << std::setw(12) << stdSort
+              << std::setw(12) << altSort
+              << std::setw(12) << pdqSort
+              << std::setw(12) << stable << std::endl;
+
+    allocator.Deallocate(scratch);
+}
+
+template <typename Datatype>
+void BenchSortType(const STR const type, Datatype (*make)(alt::u64))
+{
+    alt::Allocator<Datatype> allocator;
+    Datatype* input = allocator.Allocate(SORT_BENCH_COUNT);
+
+    for (alt::u32 i = 0; i < SORT_BENCH_COUNT; i++)
+        input[i] = make(Random());
+    BenchSortPattern(type, "random", input, SORT_BENCH_COUNT);
+
+    std::sort(input, input + SORT_BENCH_COUNT);
+    BenchSortPattern(type, "sorted", input, SORT_BENCH_COUNT);
+
+    std::reverse(input, input + SORT_BENCH_COUNT);
+    BenchSortPattern(type, "reversed", input, SORT_BENCH_COUNT);
+
+    for (alt::u32 i = 0; i < SORT_BENCH_COUNT; i++)
+        input[i] = make(Random() % 16);
+    BenchSortPattern(type, "few unique", input, SORT_BENCH_COUNT);
+
+    allocator.Deallocate(input);
+}
+
+void BenchSort(void)
+{
+    std::cout << INFO << "Sort Benchmark (" << SORT_BENCH_COUNT << " elements, milliseconds)" << std::endl;
+    std::cout << INFO << std::left << std::setw(6) << "type" << std::setw(12) << "pattern" << std::right
+              << std::setw(12) << "std::sort"
+              << std::setw(12) << "alt::Sort"
+              << std::setw(12) << "pdqsort"
+              << std::setw(12) << "stable" << std::endl;
+
+    BenchSortType<alt::u32>("u32", [](alt::u64 x) { return (alt::u32)(x); });
+    BenchSortType<alt::i64>("i64", [](alt::u64 x) { return (alt::i64)(x); });
+    BenchSortType<alt::f64>("f64", [](alt::u64 x) { return (alt::f64)((alt::i64)(x)) / 1024.0; });
+
+    std::cout << std::endl;
+}
+
+alt::u64 Nanoseconds(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// NOTE: every element is the time it was pushed, so a consumer can measure how long it sat in the queue.  Consumers
+/// count their pops locally & only add them to the shared count a batch at a time, or whenever they find the queue
+/// empty, so the count they all poll to know when to stop isn't a contended cache line on every pop.
+void BenchMpmcQueueThreads(const alt::u32 producers, const alt::u32 consumers)
+{
+    alt::MpmcQueue<alt::u64> queue(QUEUE_BENCH_CAPACITY);
+    const alt::u64 perProducer = QUEUE_BENCH_COUNT / producers;
+    const alt::u64 total       = perProducer * producers;
+    std::atomic<alt::u64> popped(0);
+    alt::Vector<alt::u64> latencies[64];
+    std::thread threads[64];
+
+    const alt::u64 start = Nanoseconds();
+    for (alt::u32 t = 0; t < producers; t++)
+        threads[t] = std::thread([&queue, perProducer](void)
+        {
+            for (alt::u64 i = 0; i < perProducer; i++)
+                queue.Push(Nanoseconds());
+        });
+    for (alt::u32 c = 0; c < consumers; c++)
+        threads[producers + c] = std::thread([&queue, &popped, &latencies, total, c](void)
+        {
+            alt::Vector<alt::u64>& samples = latencies[c];
+            alt::u64 stamp   = 0;
+            alt::u64 mine    = 0;
+            alt::u64 pending = 0;
+            for (alt::u32 attempt = 0; popped.load(std::memory_order_relaxed) < total; )
+            {
+                if (queue.TryPop(stamp))
+                {
+                    if (pending)
+                    {
+                        popped.fetch_add(pending, std::memory_order_relaxed);
+                        pending = 0;
+                    }
+                    if (++attempt >= alt::MpmcQueue<alt::u64>::SPINS)
+                        std::this_thread::yield();
+                    continue;
+                }
+                attempt = 0;
+                if (mine++ % QUEUE_LATENCY_SAMPLES == 0)
+                    samples.PushBack(Nanoseconds() - stamp);
+                if (++pending == QUEUE_POP_BATCH)
+                {
+                    popped.fetch_add(pending, std::memory_order_relaxed);
+                    pending = 0;
+                }
+            }
+        });
+    for (alt::u32 t = 0; t < producers + consumers; t++)
+        threads[t].join();
+    const alt::u64 stop = Nanoseconds();
+
+    alt::Vector<alt::u64> all;
+    for (alt::u32 c = 0; c < consumers; c++)
+        all.Append(latencies[c]);
+    all.Sort();
+    const double median = all.Empty() ? 0.0 : all[all.Size() / 2] / 1000.0;
+    const double p99    = all.Empty() ? 0.0 : all[(alt::u32)(all.Size() * 0.99)] / 1000.0;
+
+    std::cout << INFO << std::right << std::setw(10) << producers << std::setw(10) << consumers << std::fixed
+              << std::setprecision(2)
+              << std::setw(12) << total / ((stop - start) / 1000.0)
+              << std::setw(12) << median
+              << std::setw(12) << p99 << std::endl;
+}
+
+void BenchMpmcQueue(void)
+{
+    const alt::u32 cores   = std::thread::hardware_concurrency();
+    const alt::u32 maximum = cores >= 4 ? (cores / 2 < 32 ? cores / 2 : 32) : 2;
+    std::cout << INFO << "MpmcQueue Benchmark (" << QUEUE_BENCH_COUNT << " elements, capacity " << QUEUE_BENCH_CAPACITY
+              << ", Mops/s & push to pop microseconds)" << std::endl;
+    std::cout << INFO << std::right << std::setw(10) << "producers" << std::setw(10) << "consumers"
+              << std::setw(12) << "Mops/s"
+              << std::setw(12) << "median"
+              << std::setw(12) << "p99" << std::endl;
+
+    for (alt::u32 producers = 1; producers <= maximum; producers *= 2)
+        for (alt::u32 consumers = 1; consumers <= maximum; consumers *= 2)
+            BenchMpmcQueueThreads(producers, consumers);
+
+    std::cout << std::endl;
+}
+
+/// NOTE: returns the nanoseconds per lookup of 'search' over SEARCH_BENCH_QUERIES random keys
+template <class Searcher>
+double TimeSearch(const alt::u32* const queries, Searcher search)
+{
+    alt::i64 checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (alt::u32 i = 0; i < SEARCH_BENCH_QUERIES; i++)
+        checksum += search(queries[i]);
+    const auto stop = std::chrono::steady_clock::now();
+    if (checksum < 0)
+        throw alt::Except { "negative lower bound" };
+    return std::chrono::duration<double, std::nano>(stop - start).count() / SEARCH_BENCH_QUERIES;
+}
+
+void BenchSearchCount(const alt::u32 count)
+{
+    alt::Allocator<alt::u32> allocator;
+    alt::u32* keys    = allocator.Allocate(count);
+    alt::u32* queries = allocator.Allocate(SEARCH_BENCH_QUERIES);
+    for (alt::u32 i = 0; i < count; i++)
+        keys[i] = (alt::u32)(Random());
+    std::sort(keys, keys + count);
+    for (alt::u32 i = 0; i < SEARCH_BENCH_QUERIES; i++)
+        queries[i] = (alt::u32)(Random());
+
+    const alt::EytzingerIndex<alt::u32> index(keys, count);
+    const double binary    = TimeSearch(queries, [keys, count](const alt::u32 key)
+        { return alt::LowerBound(keys, count, key); });
+    const double eytzinger = TimeSearch(queries, [&index](const alt::u32 key)
+        { return index.LowerBound(key); });
+
+    std::cout << INFO << std::right << std::setw(12) << count << std::fixed << std::setprecision(2)
+              << std::setw(12) << binary
+              << std::setw(12) << eytzinger << std::endl;
+
+    allocator.Deallocate(queries);
+    allocator.Deallocate(keys);
+}
+
+void BenchSearch(void)
+{
+    std::cout << INFO << "Search Benchmark (" << SEARCH_BENCH_QUERIES << " random u32 lookups, nanoseconds each)"
+              << std::endl;
+    std::cout << INFO << std::right << std::setw(12) << "keys"
+              << std::setw(12) << "binary"
+              << std::setw(12) << "eytzinger" << std::endl;
+
+    for (alt::u32 count = 1 << 10; count <= 1 << 24; count <<= 2)
+        BenchSearchCount(count);
+
+    std::cout << std::endl;
+}
@@ -0,0 +1,687 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef BITVECTOR_HPP
+#define BITVECTOR_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Allocator.hpp"
+#include "Bits.hpp"
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h> // exclusively for the SSSE3 & AVX2 intrinsics
+#endif
+
+namespace alt // BitVector belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: BitVector packs one bit per element into 64 bit words, which every bulk operation works on a whole word at a
+/// time.  Every allocated bit past Size() is kept zero, so Count() & the word-wise operators never mask.
+///
+/// NOTE: BuildIndex() builds a rank/select index of under 5% of the bit array's size (a u16 count per 512 bit block is
+/// about 3%, a u64 count per 4096 bit superblock about 1.6%, plus the select samples), after which Rank() is O(1) and
+/// Select() is O(1) for all but pathologically sparse bit arrays.  Every modification drops the index, in which case
+/// Rank() & Select() fall back to scanning the words.
+///
+/// NOTE: Count() & BuildIndex() count whole runs of words with a nibble lookup table (a byte shuffle per 16 bits, then
+/// a sum of absolute differences per 64), 4 words at a time with AVX2 or 2 with SSSE3 when the translation unit is
+/// compiled for them (e.g. with -DALT_ARRAYMATH_AVX2=ON), & with alt::PopCount() otherwise.
+class BitVector
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+public:
+
+READONLY u64 WORD_BITS         = 64;
+READONLY u64 BLOCK_WORDS       = 8;                             // A rank block is 512 bits ...
+READONLY u64 SUPERBLOCK_WORDS  = 64;                            // ... a rank superblock is 4096 bits ...
+READONLY u64 SUPERBLOCK_BLOCKS = SUPERBLOCK_WORDS / BLOCK_WORDS;
+READONLY u64 SELECT_SAMPLE     = 4096;                          // ... & every 4096th set bit is sampled for Select()
+READONLY u64 MAXIMUM_SIZE      = (u64)(0xFFFFFFFFu) * WORD_BITS;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	u64            _Count;      // The number of bits in the BitVector
+	u64            _Length;     // The number of allocated words
+	u64*           _Words;      // The bits, least significant bit first
+	Allocator<u64> _Allocator;  // The memory Allocator of the words & the index
+
+	bool _Indexed;      // Whether the index below describes the current bits
+	u64* _Superblocks;  // _Superblocks[s] is the number of set bits before superblock s, with one past the end
+	u16* _Blocks;       // _Blocks[b] is the number of set bits before block b within its superblock, always < 4096
+	u64* _Samples;      // _Samples[j] is the superblock holding set bit j * SELECT_SAMPLE
+	u64  _Ones;         // The number of set bits when the index was built
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+BitVector() noexcept:
+	_Count(0),
+	_Length(0),
+	_Words(nullptr),
+	_Allocator(),
+	_Indexed(false),
+	_Superblocks(nullptr),
+	_Blocks(nullptr),
+	_Samples(nullptr),
+	_Ones(0)
+{}
+
+~BitVector() noexcept
+{
+	_DropIndex();
+	_Allocator.Deallocate(_Words);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// OVERLOADED CONSTRUCTORS
+public:
+
+/// NOTE: throws alt::InvalidParam if 'count' is greater than MAXIMUM_SIZE
+explicit BitVector(const u64 count, const bool value = false):
+	BitVector()
+{
+	if (count > MAXIMUM_SIZE)
+		throw alt::InvalidParam {};
+	if (count)
+	{
+		_Words  = _Allocator.Allocate((u32)(_WordsFor(count)));
+		_Length = _WordsFor(count);
+		_Count  = count;
+		_Fill(0, _Length, value ? ~(u64)(0) : 0);
+		_ClearTail();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
+public:
+
+/// NOTE: the index isn't copied, it must be rebuilt
+BitVector(const BitVector& copy):
+	BitVector()
+{
+	*this = copy;
+}
+
+BitVector(BitVector&& move) noexcept:
+	BitVector()
+{
+	*this = (BitVector&&)(move);
+}
+
+BitVector& operator = (const BitVector& copy)
+{
+	if (this != &copy)
+	{
+		_DropIndex();
+		if (this->_Length < copy._Length)
+		{
+			u64* const words = _Allocator.Allocate((u32)(copy._Length));
+			_Allocator.Deallocate(this->_Words);
+			this->_Words  = words;
+			this->_Length = copy._Length;
+		}
+		for (u64 i = 0; i < copy._WordCount(); i++)
+			this->_Words[i] = copy._Words[i];
+		this->_Fill(copy._WordCount(), this->_Length, 0);
+		this->_Count = copy._Count;
+	}
+	return *this;
+}
+
+BitVector& operator = (BitVector&& move) noexcept
+{
+	if (this != &move)
+	{
+		this->_DropIndex();
+		_Allocator.Deallocate(this->_Words);
+		this->_Count        = move._Count;
+		this->_Length       = move._Length;
+		this->_Words        = move._Words;
+		this->_Indexed      = move._Indexed;
+		this->_Superblocks  = move._Superblocks;
+		this->_Blocks       = move._Blocks;
+		this->_Samples      = move._Samples;
+		this->_Ones         = move._Ones;
+		move._Count         = 0;
+		move._Length        = 0;
+		move._Words         = nullptr;
+		move._Indexed       = false;
+		move._Superblocks   = nullptr;
+		move._Blocks        = nullptr;
+		move._Samples       = nullptr;
+		move._Ones          = 0;
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+u64 Size(void) const noexcept
+{
+	return _Count;
+}
+
+u64 Capacity(void) const noexcept
+{
+	return _Length * WORD_BITS;
+}
+
+bool Empty(void) const noexcept
+{
+	return _Count == 0;
+}
+
+bool Indexed(void) const noexcept
+{
+	return _Indexed;
+}
+
+/// NOTE: the number of words holding the bits, which Words() points to
+u64 WordCount(void) const noexcept
+{
+	return _WordCount();
+}
+
+const u64* Words(void) const noexcept
+{
+	return _Words;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// BIT ACCESSORS & MODIFIERS
+public:
+
+bool At(const u64 index) const
+{
+	if (index >= _Count)
+		throw alt::InvalidIndex();
+	return this->operator [] (index);
+}
+
+bool operator [] (const u64 index) const noexcept
+{
+	return (_Words[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+}
+
+/// NOTE: each modifier returns true if 'index' is out of bounds
+bool Set(const u64 index, const bool value = true) noexcept
+{
+	if (index >= _Count)
+		return true;
+	_Indexed = false;
+	const u64 mask = (u64)(1) << (index % WORD_BITS);
+	_Words[index / WORD_BITS] = (_Words[index / WORD_BITS] & ~mask) | (value ? mask : 0);
+	return false;
+}
+
+bool Reset(const u64 index) noexcept
+{
+	return Set(index, false);
+}
+
+bool Flip(const u64 index) noexcept
+{
+	if (index >= _Count)
+		return true;
+	_Indexed = false;
+	_Words[index / WORD_BITS] ^= (u64)(1) << (index % WORD_BITS);
+	return false;
+}
+
+void SetAll(void) noexcept
+{
+	_Indexed = false;
+	_Fill(0, _WordCount(), ~(u64)(0));
+	_ClearTail();
+}
+
+void ResetAll(void) noexcept
+{
+	_Indexed = false;
+	_Fill(0, _WordCount(), 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: returns true if the BitVector is full or the words could not be reallocated
+bool PushBack(const bool value)
+{
+	if (_Count == MAXIMUM_SIZE)
+		return true;
+	if (_Count == Capacity() && _Reallocate(_Length ? _Length * 2 : 1))
+		return true;
+	_Count++;
+	return Set(_Count - 1, value);
+}
+
+/// NOTE: returns true if the BitVector is empty
+bool PopBack(bool& rtn) noexcept
+{
+	if (! _Count)
+		return true;
+	rtn = this->operator [] (_Count - 1);
+	Reset(_Count - 1);
+	_Count--;
+	return false;
+}
+
+/// NOTE: new bits are set to 'value', returns true if 'count' is greater than MAXIMUM_SIZE or the words could not be
+/// reallocated
+bool Resize(const u64 count, const bool value = false)
+{
+	if (count > MAXIMUM_SIZE)
+		return true;
+	if (_WordsFor(count) > _Length && _Reallocate(_WordsFor(count)))
+		return true;
+	_Indexed = false;
+	if (count > _Count && value)
+	{
+		if (_Count % WORD_BITS)
+			_Words[_Count / WORD_BITS] |= ~(u64)(0) << (_Count % WORD_BITS);
+		_Fill(_WordCount(), _WordsFor(count), ~(u64)(0));
+	}
+	else if (count < _Count)
+		_Fill(_WordsFor(count), _WordCount(), 0);
+	_Count = count;
+	_ClearTail();
+	return false;
+}
+
+void Erase(void) noexcept
+{
+	ResetAll();
+	_Count = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// BULK OPERATION METHODS
+public:
+
+/// NOTE: each binary operation returns true if the sizes of the two BitVectors differ
+bool And(const BitVector& that) noexcept
+{
+	if (this->_Count != that._Count)
+		return true;
+	_Indexed = false;
+	for (u64 i = 0; i < _WordCount(); i++)
+		_Words[i] &= that._Words[i];
+	return false;
+}
+
+bool Or(const BitVector& that) noexcept
+{
+	if (this->_Count != that._Count)
+		return true;
+	_Indexed = false;
+	for (u64 i = 0; i < _WordCount(); i++)
+		_Words[i] |= that._Words[i];
+	return false;
+}
+
+bool Xor(const BitVector& that) noexcept
+{
+	if (this->_Count != that._Count)
+		return true;
+	_Indexed = false;
+	for (u64 i = 0; i < _WordCount(); i++)
+		_Words[i] ^= that._Words[i];
+	return false;
+}
+
+bool AndNot(const BitVector& that) noexcept
+{
+	if (this->_Count != that._Count)
+		return true;
+	_Indexed = false;
+	for (u64 i = 0; i < _WordCount(); i++)
+		_Words[i] &= ~that._Words[i];
+	return false;
+}
+
+void Not(void) noexcept
+{
+	_Indexed = false;
+	for (u64 i = 0; i < _WordCount(); i++)
+		_Words[i] = ~_Words[i];
+	_ClearTail();
+}
+
+bool operator &= (const BitVector& that) noexcept
+{
+	return And(that);
+}
+
+bool operator |= (const BitVector& that) noexcept
+{
+	return Or(that);
+}
+
+bool operator ^= (const BitVector& that) noexcept
+{
+	return Xor(that);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COUNTING & SEARCH METHODS
+public:
+
+/// NOTE: the number of set bits
+u64 Count(void) const noexcept
+{
+	return _Indexed ? _Ones : _PopCount(_Words, _WordCount());
+}
+
+bool Any(void) const noexcept
+{
+	for (u64 i = 0; i < _WordCount(); i++)
+		if (_Words[i])
+			return true;
+	return false;
+}
+
+bool None(void) const noexcept
+{
+	return ! Any();
+}
+
+bool All(void) const noexcept
+{
+	return Count() == _Count;
+}
+
+/// NOTE: the index of the first set bit, or -1 if none are set
+i64 FindFirst(void) const noexcept
+{
+	return _Count ? _Find(0) : -1;
+}
+
+/// NOTE: the index of the first set bit after 'index', or -1 if there are none
+i64 FindNext(const u64 index) const noexcept
+{
+	return index + 1 < _Count ? _Find(index + 1) : -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// RANK & SELECT METHODS
+public:
+
+/// NOTE: returns true if the index could not be allocated, in which case Rank() & Select() keep scanning
+bool BuildIndex(void) noexcept
+{
+	_DropIndex();
+	const u64 words       = _WordCount();
+	const u64 superblocks = (words + SUPERBLOCK_WORDS - 1) / SUPERBLOCK_WORDS;
+	const u64 blocks      = (words + BLOCK_WORDS - 1) / BLOCK_WORDS;
+	const u64 ones        = _PopCount(_Words, words);
+	const u64 samples     = ones / SELECT_SAMPLE + 1;
+	if (superblocks + 1 > 0xFFFFFFFFu || samples > 0xFFFFFFFFu)
+		return true;
+	_Superblocks = _Allocator.Malloc((u32)(superblocks + 1));
+	_Blocks      = Allocator<u16> {}.Malloc((u32)(blocks ? blocks : 1));
+	_Samples     = _Allocator.Malloc((u32)(samples));
+	if (! _Superblocks || ! _Blocks || ! _Samples)
+	{
+		_DropIndex();
+		return true;
+	}
+
+	u64 total  = 0;
+	u64 sample = 0;
+	for (u64 s = 0; s < superblocks; s++)
+	{
+		_Superblocks[s] = total;
+		u64 inner = 0;
+		for (u64 b = s * SUPERBLOCK_BLOCKS; b < blocks && b < (s + 1) * SUPERBLOCK_BLOCKS; b++)
+		{
+			_Blocks[b] = (u16)(inner);
+			const u64 end = (b + 1) * BLOCK_WORDS < words ? (b + 1) * BLOCK_WORDS : words;
+			for (u64 w = b * BLOCK_WORDS; w < end; w++)
+				inner += alt::PopCount(_Words[w]);
+		}
+		while (sample * SELECT_SAMPLE < total + inner)
+			_Samples[sample++] = s;
+		total += inner;
+	}
+	_Superblocks[superblocks] = total;
+	while (sample < samples)
+		_Samples[sample++] = superblocks;
+	_Ones    = total;
+	_Indexed = true;
+	return false;
+}
+
+/// NOTE: the number of set bits in the range [0, index), 'index' is clamped to Size()
+u64 Rank(const u64 index) const noexcept
+{
+	if (index >= _Count)
+		return Count();
+	const u64 word = index / WORD_BITS;
+	u64 rtn   = 0;
+	u64 first = 0;
+	if (_Indexed)
+	{
+		rtn   = _Superblocks[word / SUPERBLOCK_WORDS] + _Blocks[word / BLOCK_WORDS];
+		first = word / BLOCK_WORDS * BLOCK_WORDS;
+	}
+	for (u64 w = first; w < word; w++)
+		rtn += alt::PopCount(_Words[w]);
+	if (index % WORD_BITS)
+		rtn += alt::PopCount(_Words[word] << (WORD_BITS - index % WORD_BITS));
+	return rtn;
+}
+
+/// NOTE: the index of set bit number 'rank' counting from zero, or -1 if fewer than 'rank' + 1 bits are set
+i64 Select(u64 rank) const noexcept
+{
+	u64 word = 0;
+	if (_Indexed)
+	{
+		if (rank >= _Ones)
+			return -1;
+		u64 s = _Samples[rank / SELECT_SAMPLE];
+		while (_Superblocks[s + 1] <= rank)
+			s++;
+		rank -= _Superblocks[s];
+		u64 b = s * SUPERBLOCK_BLOCKS;
+		const u64 blocks = (_WordCount() + BLOCK_WORDS - 1) / BLOCK_WORDS;
+		while (b + 1 < blocks && b + 1 < (s + 1) * SUPERBLOCK_BLOCKS && _Blocks[b + 1] <= rank)
+			b++;
+		rank -= _Blocks[b];
+		word = b * BLOCK_WORDS;
+	}
+	for (; word < _WordCount(); word++)
+	{
+		const u64 ones = alt::PopCount(_Words[word]);
+		if (rank < ones)
+			return (i64)(word * WORD_BITS + _SelectInWord(_Words[word], (u32)(rank)));
+		rank -= ones;
+	}
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// BITVECTOR OPERATION METHODS
+public:
+
+bool Equals(const BitVector& that) const noexcept
+{
+	if (this->_Count != that._Count)
+		return false;
+	for (u64 i = 0; i < _WordCount(); i++)
+		if (this->_Words[i] != that._Words[i])
+			return false;
+	return true;
+}
+
+bool operator == (const BitVector& that) const noexcept
+{
+	return this->Equals(that);
+}
+
+/// NOTE: returns the opposite of operator ==
+bool operator != (const BitVector& that) const noexcept
+{
+	return ! this->operator == (that);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// HELPER METHODS
+private:
+
+static u64 _WordsFor(const u64 bits) noexcept
+{
+	return (bits + WORD_BITS - 1) / WORD_BITS;
+}
+
+u64 _WordCount(void) const noexcept
+{
+	return _WordsFor(_Count);
+}
+
+void _Fill(const u64 from, const u64 to, const u64 word) noexcept
+{
+	for (u64 i = from; i < to; i++)
+		_Words[i] = word;
+}
+
+/// NOTE: zeroes the bits of the last word past _Count
+void _ClearTail(void) noexcept
+{
+	if (_Count % WORD_BITS)
+		_Words[_Count / WORD_BITS] &= ~(u64)(0) >> (WORD_BITS - _Count % WORD_BITS);
+}
+
+/// NOTE: keeps the words, returns true if the new words could not be allocated
+bool _Reallocate(const u64 length)
+{
+	if (length > 0xFFFFFFFFu)
+		return true;
+	u64* const words = _Allocator.Malloc((u32)(length));
+	if (! words)
+		return true;
+	for (u64 i = 0; i < _WordCount(); i++)
+		words[i] = _Words[i];
+	for (u64 i = _WordCount(); i < length; i++)
+		words[i] = 0;
+	_Allocator.Deallocate(_Words);
+	_Words  = words;
+	_Length = length;
+	return false;
+}
+
+void _DropIndex(void) noexcept
+{
+	_Indexed = false;
+	_Allocator.Deallocate(_Superblocks);
+	Allocator<u16> {}.Deallocate(_Blocks);
+	_Allocator.Deallocate(_Samples);
+}
+
+i64 _Find(const u64 index) const noexcept
+{
+	u64 word = index / WORD_BITS;
+	u64 bits = _Words[word] & (~(u64)(0) << (index % WORD_BITS));
+	while (! bits)
+	{
+		if (++word == _WordCount())
+			return -1;
+		bits = _Words[word];
+	}
+	return (i64)(word * WORD_BITS + alt::CountTrailingZeros(bits));
+}
+
+/// NOTE: the position of set bit number 'rank' within 'word', which must have more than 'rank' bits set
+static u32 _SelectInWord(u64 word, u32 rank) noexcept
+{
+	u32 shift = 0;
+	for (u32 ones = alt::PopCount(word & 0xFF); ones <= rank; ones = alt::PopCount(word & 0xFF))
+	{
+		rank  -= ones;
+		word >>= 8;
+		shift += 8;
+	}
+	for (; rank; rank--)
+		word &= word - 1;
+	return shift + alt::CountTrailingZeros(word);
+}
+
+/// NOTE: a SWAR popcount summed per byte, which compilers vectorize over the words on every SIMD target rather than
+/// making one popcount call per word when no popcount instruction is enabled
+/// NOTE: the bytes' low & high nibbles index a 16 entry table of bit counts, & the byte counts are summed into one u64
+/// per 8 bytes with a sum of absolute differences against zero
+static u64 _PopCount(const u64* const words, const u64 count) noexcept
+{
+	u64 total = 0;
+	u64 i = 0;
+#if defined(__AVX2__)
+	const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	                                       0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	__m256i sums = _mm256_setzero_si256();
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m256i x    = _mm256_loadu_si256((const __m256i*)(words + i));
+		const __m256i low  = _mm256_shuffle_epi8(table, _mm256_and_si256(x, nibble));
+		const __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble));
+		sums = _mm256_add_epi64(sums, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+	}
+	total += (u64)(_mm256_extract_epi64(sums, 0)) + (u64)(_mm256_extract_epi64(sums, 1)) +
+	         (u64)(_mm256_extract_epi64(sums, 2)) + (u64)(_mm256_extract_epi64(sums, 3));
+#elif defined(__SSSE3__)
+	const __m128i table  = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m128i nibble = _mm_set1_epi8(0x0F);
+	__m128i sums = _mm_setzero_si128();
+	for (; i + 2 <= count; i += 2)
+	{
+		const __m128i x    = _mm_loadu_si128((const __m128i*)(words + i));
+		const __m128i low  = _mm_shuffle_epi8(table, _mm_and_si128(x, nibble));
+		const __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(x, 4), nibble));
+		sums = _mm_add_epi64(sums, _mm_sad_epu8(_mm_add_epi8(low, high), _mm_setzero_si128()));
+	}
+	u64 lanes[2];
+	_mm_storeu_si128((__m128i*)(lanes), sums);
+	total += lanes[0] + lanes[1];
+#endif
+	for (; i < count; i++)
+		total += alt::PopCount(words[i]);
+	return total;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end BITVECTOR_HPP
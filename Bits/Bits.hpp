@@ -0,0 +1,122 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef BITS_HPP
+#define BITS_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+
+/// BIT MANIPULATION INTRINSICS ////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER     // if we're using the Microsoft C++ Compiler (cl.exe)
+
+#include <intrin.h>
+
+namespace alt   // bit intrinsics for namespace alt
+{
+////////////////////////////////////////////////////////////
+
+/// NOTE: returns 64 if x == 0
+inline u32 CountLeadingZeros(const u64 x) noexcept
+{
+	unsigned long index = 0;
+	return _BitScanReverse64(&index, x) ? 63 - (u32)(index) : 64;
+}
+
+/// NOTE: returns 64 if x == 0
+inline u32 CountTrailingZeros(const u64 x) noexcept
+{
+	unsigned long index = 0;
+	return _BitScanForward64(&index, x) ? (u32)(index) : 64;
+}
+
+inline u32 PopCount(const u64 x) noexcept
+{
+	return (u32)(__popcnt64(x));
+}
+
+////////////////////////////////////////////////////////////
+}; // end namespace alt
+
+#else   // if we're using any other compiler
+
+namespace alt   // bit intrinsics for namespace alt
+{
+////////////////////////////////////////////////////////////
+
+/// NOTE: returns 64 if x == 0
+constexpr u32 CountLeadingZeros(const u64 x) noexcept
+{
+	return x ? (u32)(__builtin_clzll(x)) : 64;
+}
+
+/// NOTE: returns 64 if x == 0
+constexpr u32 CountTrailingZeros(const u64 x) noexcept
+{
+	return x ? (u32)(__builtin_ctzll(x)) : 64;
+}
+
+/// NOTE: one popcnt instruction when the target has it (-mpopcnt, which -msse4.2 & -mavx2 imply), otherwise a SWAR
+/// sum, since __builtin_popcountll() without it becomes a call into libgcc
+constexpr u32 PopCount(const u64 x) noexcept
+{
+#if defined(__POPCNT__)
+	return (u32)(__builtin_popcountll(x));
+#else
+	u64 y = x - ((x >> 1) & 0x5555555555555555ull);
+	y = (y & 0x3333333333333333ull) + ((y >> 2) & 0x3333333333333333ull);
+	y = (y + (y >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+	return (u32)((y * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+////////////////////////////////////////////////////////////
+}; // end namespace alt
+
+#endif // _MSC_VER
+
+namespace alt   // bit utilities for namespace alt
+{
+////////////////////////////////////////////////////////////
+
+/// NOTE: returns floor(log2(x)), x must be non-zero
+inline u32 Log2Floor(const u64 x) noexcept
+{
+	return 63 - CountLeadingZeros(x);
+}
+
+/// NOTE: returns the smallest power of two greater than or equal to x, x must be in the range [1, 2^63]
+inline u64 NextPowerOfTwo(const u64 x) noexcept
+{
+	return x <= 1 ? 1 : (u64)(1) << (64 - CountLeadingZeros(x - 1));
+}
+
+inline bool IsPowerOfTwo(const u64 x) noexcept
+{
+	return x && ! (x & (x - 1));
+}
+
+////////////////////////////////////////////////////////////
+}; // end namespace alt
+
+#endif // end BITS_HPP
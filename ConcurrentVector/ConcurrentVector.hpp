@@ -0,0 +1,346 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef CONCURRENTVECTOR_HPP
+#define CONCURRENTVECTOR_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Allocator.hpp"
+#include "Bits.hpp"
+
+#include <atomic> // exclusively for std::atomic
+#include <thread> // exclusively for std::this_thread::yield()
+
+namespace alt // ConcurrentVector belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: ConcurrentVector is an append-only vector any number of threads may PushBack() into at once without a lock.
+/// A writer claims its slot with a single atomic fetch-add, then copies its element into the slot & publishes it by
+/// setting the slot's ready flag with release semantics, so writers only ever contend on the one counter.
+///
+/// NOTE: the slots live in the power-of-two segments of alt::SegmentedVector, which are never moved.  The first writer
+/// to need a segment claims it with an atomic exchange & is the only one to allocate it, writers arriving while it's
+/// being allocated yield until it's installed in the segment table.  A reference to a
+/// published element therefore stays valid for the life of the ConcurrentVector.
+///
+/// NOTE: Size() is the length of the prefix of published elements, which readers advance lazily, so an element pushed
+/// by a slow writer hides the elements pushed after it from Size() (but not from Ready()) until it is published.
+///
+/// WARN: only the constructors, Reserve(), PushBack(), & the accessors are safe to call concurrently, Erase() & the
+/// assignment operators require that no other thread is using the ConcurrentVector
+template <typename Datatype>
+class ConcurrentVector
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+public:
+
+READONLY u32 FIRST_SEGMENT_BITS   = 4;
+READONLY u32 FIRST_SEGMENT_LENGTH = 1u << FIRST_SEGMENT_BITS;
+READONLY u32 SEGMENT_TABLE_LENGTH = 32 - FIRST_SEGMENT_BITS;
+READONLY u32 MAXIMUM_CAPACITY     = 0xFFFFFFFFu - FIRST_SEGMENT_LENGTH + 1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SLOT
+private:
+
+class _Slot
+{
+public:
+	Datatype          _Value;
+	std::atomic<bool> _Ready;
+
+	_Slot() noexcept:
+		_Value(),
+		_Ready(false)
+	{}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	alignas(64) std::atomic<u64>         _Reserved;     // The number of slots claimed by writers, on its own cache line
+	alignas(64) mutable std::atomic<u32> _Published;    // A lower bound on the length of the published prefix
+	Allocator<_Slot>                     _Allocator;    // The memory Allocator of the segments
+	std::atomic<_Slot*>                  _Table[SEGMENT_TABLE_LENGTH];
+	std::atomic<bool>                    _Claimed[SEGMENT_TABLE_LENGTH]; // Whether a writer has begun allocating each segment
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+ConcurrentVector() noexcept:
+	_Reserved(0),
+	_Published(0),
+	_Allocator()
+{
+	for (u32 k = 0; k < SEGMENT_TABLE_LENGTH; k++)
+	{
+		_Table[k].store(nullptr, std::memory_order_relaxed);
+		_Claimed[k].store(false, std::memory_order_relaxed);
+	}
+}
+
+~ConcurrentVector() noexcept
+{
+	_Free();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
+public:
+
+ConcurrentVector(const ConcurrentVector& copy) = delete;
+ConcurrentVector& operator = (const ConcurrentVector& copy) = delete;
+
+ConcurrentVector(ConcurrentVector&& move) noexcept:
+	_Reserved(move._Reserved.load(std::memory_order_relaxed)),
+	_Published(move._Published.load(std::memory_order_relaxed)),
+	_Allocator()
+{
+	for (u32 k = 0; k < SEGMENT_TABLE_LENGTH; k++)
+	{
+		_Table[k].store(move._Table[k].exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
+		_Claimed[k].store(move._Claimed[k].exchange(false, std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+	move._Reserved.store(0, std::memory_order_relaxed);
+	move._Published.store(0, std::memory_order_relaxed);
+}
+
+ConcurrentVector& operator = (ConcurrentVector&& move) noexcept
+{
+	if (this != &move)
+	{
+		this->_Free();
+		for (u32 k = 0; k < SEGMENT_TABLE_LENGTH; k++)
+		{
+			this->_Table[k].store(move._Table[k].exchange(nullptr, std::memory_order_relaxed),
+			                      std::memory_order_relaxed);
+			this->_Claimed[k].store(move._Claimed[k].exchange(false, std::memory_order_relaxed),
+			                        std::memory_order_relaxed);
+		}
+		this->_Reserved.store(move._Reserved.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+		this->_Published.store(move._Published.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+/// NOTE: the length of the prefix of published elements, every index below it is Ready()
+u32 Size(void) const noexcept
+{
+	u32 published = _Published.load(std::memory_order_acquire);
+	const u32 start = published;
+	while (published < Reserved() && Ready(published))
+		published++;
+	if (published != start)
+	{
+		u32 expected = start;
+		while (expected < published &&
+		       ! _Published.compare_exchange_weak(expected, published, std::memory_order_release,
+		                                          std::memory_order_acquire))
+			;
+		if (expected > published)
+			published = expected;
+	}
+	return published;
+}
+
+/// NOTE: the number of slots claimed so far, including those whose elements are still being written
+u32 Reserved(void) const noexcept
+{
+	const u64 reserved = _Reserved.load(std::memory_order_acquire);
+	return reserved < MAXIMUM_CAPACITY ? (u32)(reserved) : MAXIMUM_CAPACITY;
+}
+
+bool Empty(void) const noexcept
+{
+	return Size() == 0;
+}
+
+/// NOTE: the number of slots in the allocated segments, which may have gaps while writers install segments
+u32 Capacity(void) const noexcept
+{
+	u32 segments = 0;
+	while (segments < SEGMENT_TABLE_LENGTH && _Table[segments].load(std::memory_order_acquire))
+		segments++;
+	return _SegmentStart(segments);
+}
+
+/// NOTE: returns true if the element at 'index' has been published
+bool Ready(const u32 index) const noexcept
+{
+	if (index >= MAXIMUM_CAPACITY)
+		return false;
+	const u32 segment = _SegmentOf(index);
+	const _Slot* const slots = _Table[segment].load(std::memory_order_acquire);
+	return slots && slots[index - _SegmentStart(segment)]._Ready.load(std::memory_order_acquire);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+/// NOTE: throws alt::InvalidIndex unless the element at 'index' has been published
+const Datatype& At(const u32 index) const
+{
+	if (! Ready(index))
+		throw alt::InvalidIndex();
+	return this->operator [] (index);
+}
+
+/// WARN: 'index' must be Ready(), or below a Size() this thread has observed
+const Datatype& operator [] (const u32 index) const noexcept
+{
+	const u32 segment = _SegmentOf(index);
+	return _Table[segment].load(std::memory_order_acquire)[index - _SegmentStart(segment)]._Value;
+}
+
+/// NOTE: copies the element at 'index' into 'rtn', returns true if it has not been published yet
+bool TryGet(const u32 index, Datatype& rtn) const noexcept
+{
+	if (! Ready(index))
+		return true;
+	rtn = this->operator [] (index);
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: returns true if the ConcurrentVector is full, writes the index 'x' was published at into 'index' otherwise
+bool PushBack(const Datatype& x, u32& index)
+{
+	const u64 reserved = _Reserved.fetch_add(1, std::memory_order_relaxed);
+	if (reserved >= MAXIMUM_CAPACITY)
+		return true;
+	index = (u32)(reserved);
+	const u32 segment = _SegmentOf(index);
+	_Slot* slots = _Table[segment].load(std::memory_order_acquire);
+	if (! slots)
+		slots = _Install(segment);
+	_Slot& slot = slots[index - _SegmentStart(segment)];
+	slot._Value = x;
+	slot._Ready.store(true, std::memory_order_release);
+	return false;
+}
+
+bool PushBack(const Datatype& x)
+{
+	u32 index = 0;
+	return PushBack(x, index);
+}
+
+/// NOTE: allocates every segment needed to hold 'capacity' elements up front so that writers never have to, returns
+/// true if 'capacity' is greater than MAXIMUM_CAPACITY
+bool Reserve(const u32 capacity)
+{
+	if (capacity > MAXIMUM_CAPACITY)
+		return true;
+	if (! capacity)
+		return false;
+	for (u32 k = 0; k <= _SegmentOf(capacity - 1); k++)
+		if (! _Table[k].load(std::memory_order_acquire))
+			_Install(k);
+	return false;
+}
+
+/// WARN: not thread safe
+void Erase(void) noexcept
+{
+	_Free();
+	_Reserved.store(0, std::memory_order_relaxed);
+	_Published.store(0, std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEGMENT HELPER METHODS
+public:
+
+static u32 SegmentLength(const u32 segment) noexcept
+{
+	return FIRST_SEGMENT_LENGTH << segment;
+}
+
+private:
+
+static u32 _SegmentOf(const u32 index) noexcept
+{
+	return alt::Log2Floor((u64)(index) + FIRST_SEGMENT_LENGTH) - FIRST_SEGMENT_BITS;
+}
+
+static u32 _SegmentStart(const u32 segment) noexcept
+{
+	return (u32)(((u64)(FIRST_SEGMENT_LENGTH) << segment) - FIRST_SEGMENT_LENGTH);
+}
+
+/// NOTE: only the writer that claims 'segment' allocates it, every other writer racing to install it yields until the
+/// claimant publishes it.  If the allocation throws the claim is dropped, so a waiting writer can claim it & retry.
+_Slot* _Install(const u32 segment)
+{
+	_Slot* slots = nullptr;
+	while (! (slots = _Table[segment].load(std::memory_order_acquire)))
+	{
+		if (_Claimed[segment].exchange(true, std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		try
+		{
+			slots = _Allocator.Allocate(SegmentLength(segment));
+		}
+		catch (...)
+		{
+			_Claimed[segment].store(false, std::memory_order_release);
+			throw;
+		}
+		_Table[segment].store(slots, std::memory_order_release);
+	}
+	return slots;
+}
+
+void _Free(void) noexcept
+{
+	for (u32 k = 0; k < SEGMENT_TABLE_LENGTH; k++)
+	{
+		_Slot* slots = _Table[k].exchange(nullptr, std::memory_order_relaxed);
+		_Allocator.Deallocate(slots);
+		_Claimed[k].store(false, std::memory_order_relaxed);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end CONCURRENTVECTOR_HPP
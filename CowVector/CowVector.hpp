@@ -0,0 +1,460 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef COWVECTOR_HPP
+#define COWVECTOR_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Allocator.hpp"
+#include "Vector.hpp"
+
+#include <atomic>      // exclusively for std::atomic
+#include <cstring>     // exclusively for std::memcpy()
+#include <new>         // exclusively for std::bad_alloc
+#include <type_traits> // exclusively for std::is_trivially_copyable
+
+namespace alt // CowVector belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: CowVector is a copy-on-write alt::Vector.  Copies share one reference counted buffer, so copying is O(1) no
+/// matter the length, and the buffer is only cloned by the first mutating call made on a copy which shares it.
+/// Const access never clones.  The reference count is atomic, so distinct CowVectors sharing a buffer may be read
+/// and written from distinct threads, but a single CowVector is no more thread safe than an alt::Vector.
+///
+/// WARN: a reference returned by a non-const accessor stays bound to the buffer it was taken from.  Writing through it
+/// after this CowVector has been copied writes into both copies, so re-fetch references after copying.
+template < typename Datatype, class Allocator = alt::Allocator<Datatype> >
+class CowVector
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SHARED BUFFER
+private:
+
+class _Buffer final
+{
+public:
+	std::atomic<u32> _References;
+	u32              _Count;
+	u32              _Length;
+	Datatype*        _Array;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	Allocator _Allocator;
+	_Buffer*  _Shared;    // nullptr until the CowVector first holds capacity
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+CowVector() noexcept:
+	_Allocator(),
+	_Shared(nullptr)
+{}
+
+~CowVector() noexcept
+{
+	_Release();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// OVERLOADED CONSTRUCTORS
+public:
+
+explicit CowVector(const u32 initLength):
+	_Allocator(),
+	_Shared(nullptr)
+{
+	if (initLength)
+		_Shared = _Make(initLength);
+}
+
+/// NOTE: deep copies 'vector', which is the only copy a CowVector made from a Vector will ever need
+template <class... Policies>
+explicit CowVector(const alt::Vector<Datatype, Allocator, Policies...>& vector):
+	_Allocator(),
+	_Shared(nullptr)
+{
+	if (vector.Size())
+	{
+		_Shared = _Make(vector.Size());
+		_Copy(_Shared->_Array, vector.Data(), vector.Size());
+		_Shared->_Count = vector.Size();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
+public:
+
+/// NOTE: O(1), shares the buffer of 'copy'
+CowVector(const CowVector& copy) noexcept:
+	_Allocator(copy._Allocator),
+	_Shared(copy._Shared)
+{
+	if (_Shared)
+		_Shared->_References.fetch_add(1, std::memory_order_relaxed);
+}
+
+CowVector(CowVector&& move) noexcept:
+	_Allocator((Allocator&&)(move._Allocator)),
+	_Shared(move._Shared)
+{
+	move._Shared = nullptr;
+}
+
+/// NOTE: O(1), shares the buffer of 'copy'
+CowVector& operator = (const CowVector& copy) noexcept
+{
+	if (this->_Shared != copy._Shared)
+	{
+		if (copy._Shared)
+			copy._Shared->_References.fetch_add(1, std::memory_order_relaxed);
+		this->_Release();
+		this->_Shared = copy._Shared;
+	}
+	return *this;
+}
+
+CowVector& operator = (CowVector&& move) noexcept
+{
+	if (this != &move)
+	{
+		this->_Release();
+		this->_Shared = move._Shared;
+		move._Shared  = nullptr;
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+/// NOTE: in u64, so that a snapshot over 4 GiB doesn't wrap & under-copy
+u64 DataSize(const u64 num = 1) const noexcept
+{
+	return sizeof(Datatype) * num;
+}
+
+u32 Size(void) const noexcept
+{
+	return _Shared ? _Shared->_Count : 0;
+}
+
+u32 Capacity(void) const noexcept
+{
+	return _Shared ? _Shared->_Length : 0;
+}
+
+bool Empty(void) const noexcept
+{
+	return Size() == 0;
+}
+
+bool Full(void) const noexcept
+{
+	return Size() == Capacity();
+}
+
+/// NOTE: the number of CowVectors sharing this buffer, zero if this CowVector holds no buffer
+u32 UseCount(void) const noexcept
+{
+	return _Shared ? _Shared->_References.load(std::memory_order_acquire) : 0;
+}
+
+/// NOTE: true if a mutating call would not have to clone the buffer
+bool Unique(void) const noexcept
+{
+	return UseCount() <= 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY MODIFIERS
+public:
+
+/// NOTE: returns true if the CowVector can already hold 'newCapacity' elements without cloning
+bool Grow(const u32 newCapacity)
+{
+	if (newCapacity <= Capacity() && Unique())
+		return true;
+	_Own(newCapacity);
+	return false;
+}
+
+/// NOTE: clones the buffer now if it is shared, so that later writes never pay for the clone
+void Detach(void)
+{
+	if (_Shared)
+		_Own(0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS & MODIFIERS
+public:
+
+const Datatype& At(const u32 index) const
+{
+	if (index >= Size())
+		throw alt::InvalidIndex();
+	return _Shared->_Array[index];
+}
+
+/// NOTE: clones the buffer if it is shared
+Datatype& At(const u32 index)
+{
+	if (index >= Size())
+		throw alt::InvalidIndex();
+	_Own(0);
+	return _Shared->_Array[index];
+}
+
+const Datatype& operator [] (const u32 index) const noexcept
+{
+	return _Shared->_Array[index];
+}
+
+/// NOTE: clones the buffer if it is shared
+Datatype& operator [] (const u32 index)
+{
+	_Own(0);
+	return _Shared->_Array[index];
+}
+
+const Datatype* Data(void) const noexcept
+{
+	return _Shared ? _Shared->_Array : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEARCH METHODS
+public:
+
+bool Contains(const Datatype& x) const noexcept
+{
+	return IndexOf(x) >= 0;
+}
+
+i64 IndexOf(const Datatype& x) const noexcept
+{
+	const Datatype* const array = Data();
+	const u32 count = Size();
+	for (u32 i = 0; i < count; i++)
+		if (array[i] == x)
+			return i;
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+bool PushBack(const Datatype& x)
+{
+	const u32 count = Size();
+	if (count == 0xFFFFFFFFu)
+		return true;
+	_Own(count + 1);
+	_Shared->_Array[count] = x;
+	_Shared->_Count++;
+	return false;
+}
+
+bool PopBack(Datatype& rtn)
+{
+	if (Empty())
+		return true;
+	_Own(0);
+	rtn = (Datatype&&)(_Shared->_Array[--_Shared->_Count]);
+	return false;
+}
+
+/// NOTE: index can be within the range [0, Size()], otherwise this method fails and returns true
+bool Insert(const u32 index, const Datatype& x)
+{
+	const u32 count = Size();
+	if (index > count || count == 0xFFFFFFFFu)
+		return true;
+	_Own(count + 1);
+	Datatype* const array = _Shared->_Array;
+	for (u32 i = count; i > index; i--)
+		array[i] = (Datatype&&)(array[i - 1]);
+	array[index] = x;
+	_Shared->_Count++;
+	return false;
+}
+
+bool Remove(const u32 index)
+{
+	const u32 count = Size();
+	if (index >= count)
+		return true;
+	_Own(0);
+	Datatype* const array = _Shared->_Array;
+	for (u32 i = index + 1; i < count; i++)
+		array[i - 1] = (Datatype&&)(array[i]);
+	_Shared->_Count--;
+	return false;
+}
+
+/// NOTE: a shared buffer is simply let go of rather than cloned & cleared
+void Erase(void) noexcept
+{
+	if (! _Shared)
+		return;
+	if (Unique())
+		_Shared->_Count = 0;
+	else
+	{
+		_Release();
+		_Shared = nullptr;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// VECTOR OPERATION METHODS
+public:
+
+/// NOTE: O(1) when both CowVectors share a buffer
+bool Equals(const CowVector& that) const noexcept
+{
+	if (this->_Shared == that._Shared)
+		return true;
+	const u32 count = this->Size();
+	if (count != that.Size())
+		return false;
+	const Datatype* const thisArray = this->Data();
+	const Datatype* const thatArray = that.Data();
+	for (u32 i = 0; i < count; i++)
+		if (thisArray[i] != thatArray[i])
+			return false;
+	return true;
+}
+
+bool operator == (const CowVector& that) const noexcept
+{
+	return this->Equals(that);
+}
+
+/// NOTE: returns the opposite of operator ==
+bool operator != (const CowVector& that) const noexcept
+{
+	return ! this->operator == (that);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// BUFFER HELPER METHODS
+private:
+
+_Buffer* _Make(const u32 length)
+{
+	_Buffer* buffer = nullptr;
+	try
+	{
+		buffer = new _Buffer;
+	}
+	catch (const std::bad_alloc& ba)
+	{
+		throw alt::MallocFailure {};
+	}
+	buffer->_References.store(1, std::memory_order_relaxed);
+	buffer->_Count  = 0;
+	buffer->_Length = length;
+	try
+	{
+		buffer->_Array = _Allocator.Allocate(length);
+	}
+	catch (...)
+	{
+		delete buffer;
+		throw;
+	}
+	return buffer;
+}
+
+void _Copy(Datatype* const dst, const Datatype* const src, const u32 count)
+{
+	if constexpr (std::is_trivially_copyable<Datatype>::value)
+	{
+		if (count)
+			std::memcpy(dst, src, DataSize(count));
+	}
+	else
+		for (u32 i = 0; i < count; i++)
+			dst[i] = src[i];
+}
+
+/// NOTE: drops this CowVector's reference, freeing the buffer if it was the last one
+void _Release(void) noexcept
+{
+	if (_Shared && _Shared->_References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		_Allocator.Deallocate(_Shared->_Array);
+		delete _Shared;
+	}
+	_Shared = nullptr;
+}
+
+/// NOTE: guarantees this CowVector is the sole owner of a buffer with room for at least 'minLength' elements, cloning
+/// a shared buffer (copying its elements) or regrowing a private one (moving its elements) only when it must
+void _Own(const u32 minLength)
+{
+	const bool unique = Unique();
+	const u32  length = Capacity();
+	if (_Shared && unique && length >= minLength)
+		return;
+	u64 newLength = length;
+	if (newLength < minLength)
+	{
+		newLength = length ? (u64)(length) * 2 : 1;
+		if (newLength < minLength)
+			newLength = minLength;
+		if (newLength > 0xFFFFFFFFull)
+			newLength = 0xFFFFFFFFull;
+	}
+	if (! newLength)
+		return;
+	_Buffer* const fresh = _Make((u32)(newLength));
+	const u32 count = Size();
+	if (unique && _Shared)
+		for (u32 i = 0; i < count; i++)
+			fresh->_Array[i] = (Datatype&&)(_Shared->_Array[i]);
+	else if (count)
+		_Copy(fresh->_Array, _Shared->_Array, count);
+	fresh->_Count = count;
+	_Release();
+	_Shared = fresh;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end COWVECTOR_HPP
@@ -0,0 +1,396 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Bits.hpp"
+#include "Allocator.hpp"
+
+namespace alt // Deque belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: Deque is a ring buffer whose capacity is always a power of two, so a logical index maps onto its slot with a
+/// single mask & both ends push & pop in O(1).  When it fills up it unwraps its elements, front first, into storage
+/// twice the size.
+///
+/// NOTE: the elements are contiguous in at most two spans, see Spans(), which lets bulk reads & writes run as plain
+/// array loops instead of one masked index per element.
+template <typename Datatype, class Allocator = alt::Allocator<Datatype>>
+class Deque
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS & SPANS
+public:
+
+READONLY u32 MINIMUM_CAPACITY = 8;
+READONLY u32 MAXIMUM_CAPACITY = (u32)(1) << 31;
+
+/// NOTE: a run of elements which are contiguous in memory
+template <typename Element>
+class Span
+{
+public:
+	Element* _Data;
+	u32      _Count;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	u32       _Head;        // The slot of the front element
+	u32       _Count;       // The number of elements in the Deque
+	u32       _Length;      // The number of slots, zero or a power of two
+	Allocator _Allocator;   // The memory Allocator of the Deque
+	Datatype* _Array;       // The ring of slots
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+Deque() noexcept:
+	_Head(0),
+	_Count(0),
+	_Length(0),
+	_Allocator(),
+	_Array(nullptr)
+{}
+
+/// NOTE: rounds 'capacity' up to a power of two
+explicit Deque(const u32 capacity):
+	Deque()
+{
+	Grow(capacity);
+}
+
+~Deque() noexcept
+{
+	_Allocator.Deallocate(_Array);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
+public:
+
+/// NOTE: the copy is unwrapped, its front element is in its first slot
+Deque(const Deque& copy):
+	_Head(0),
+	_Count(copy._Count),
+	_Length(copy._Length),
+	_Allocator(copy._Allocator),
+	_Array(nullptr)
+{
+	if (_Length)
+	{
+		_Array = _Allocator.Allocate(_Length);
+		for (u32 i = 0; i < _Count; i++)
+			_Array[i] = copy[i];
+	}
+}
+
+Deque(Deque&& move) noexcept:
+	_Head(move._Head),
+	_Count(move._Count),
+	_Length(move._Length),
+	_Allocator((Allocator&&)(move._Allocator)),
+	_Array(move._Array)
+{
+	move._Head   = 0;
+	move._Count  = 0;
+	move._Length = 0;
+	move._Array  = nullptr;
+}
+
+Deque& operator = (const Deque& copy)
+{
+	if (this == &copy)
+		return *this;
+	Deque tmp(copy);
+	return this->operator = ((Deque&&)(tmp));
+}
+
+Deque& operator = (Deque&& move) noexcept
+{
+	if (this == &move)
+		return *this;
+	_Allocator.Deallocate(_Array);
+	_Head        = move._Head;
+	_Count       = move._Count;
+	_Length      = move._Length;
+	_Allocator   = (Allocator&&)(move._Allocator);
+	_Array       = move._Array;
+	move._Head   = 0;
+	move._Count  = 0;
+	move._Length = 0;
+	move._Array  = nullptr;
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+u32 Size(void) const noexcept
+{
+	return _Count;
+}
+
+u32 Capacity(void) const noexcept
+{
+	return _Length;
+}
+
+bool Empty(void) const noexcept
+{
+	return _Count == 0;
+}
+
+bool Full(void) const noexcept
+{
+	return _Count == _Length;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY MODIFIERS
+public:
+
+/// NOTE: grows to twice the current capacity
+bool Grow(void)
+{
+	return Grow(_Length ? _Length * 2 : MINIMUM_CAPACITY);
+}
+
+/// NOTE: rounds 'capacity' up to a power of two & unwraps the elements into the new storage, returns true if that
+/// wouldn't grow the Deque or exceeds MAXIMUM_CAPACITY
+bool Grow(const u32 capacity)
+{
+	if (capacity <= _Length ||
+		capacity >  MAXIMUM_CAPACITY)
+		return true;
+	const u32 length = (u32)(alt::NextPowerOfTwo(capacity < MINIMUM_CAPACITY ? MINIMUM_CAPACITY : capacity));
+	Datatype* const array = _Allocator.Allocate(length);
+	for (u32 i = 0; i < _Count; i++)
+		array[i] = (Datatype&&)(_Array[_Slot(i)]);
+	_Allocator.Deallocate(_Array);
+	_Array  = array;
+	_Length = length;
+	_Head   = 0;
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+const Datatype& At(const u32 index) const
+{
+	if (index >= _Count)
+		throw alt::InvalidIndex();
+	return _Array[_Slot(index)];
+}
+
+Datatype& At(const u32 index)
+{
+	if (index >= _Count)
+		throw alt::InvalidIndex();
+	return _Array[_Slot(index)];
+}
+
+const Datatype& operator [] (const u32 index) const noexcept
+{
+	return _Array[_Slot(index)];
+}
+
+Datatype& operator [] (const u32 index) noexcept
+{
+	return _Array[_Slot(index)];
+}
+
+const Datatype& PeekFront(void) const
+{
+	return At(0);
+}
+
+Datatype& PeekFront(void)
+{
+	return At(0);
+}
+
+const Datatype& PeekBack(void) const
+{
+	return At(_Count - 1);
+}
+
+Datatype& PeekBack(void)
+{
+	return At(_Count - 1);
+}
+
+/// NOTE: the elements in order are first._Data[0 .. first._Count) followed by second._Data[0 .. second._Count), the
+/// second span is empty unless the elements wrap around the end of the ring
+void Spans(Span<const Datatype>& first, Span<const Datatype>& second) const noexcept
+{
+	const u32 front = _Length - _Head < _Count ? _Length - _Head : _Count;
+	first  = Span<const Datatype> { _Array + _Head, front };
+	second = Span<const Datatype> { _Array, _Count - front };
+}
+
+void Spans(Span<Datatype>& first, Span<Datatype>& second) noexcept
+{
+	const u32 front = _Length - _Head < _Count ? _Length - _Head : _Count;
+	first  = Span<Datatype> { _Array + _Head, front };
+	second = Span<Datatype> { _Array, _Count - front };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+bool PushFront(const Datatype& x)
+{
+	if (Full() && Grow())
+		return true;
+	_Head = (_Head - 1) & (_Length - 1);
+	_Array[_Head] = x;
+	_Count++;
+	return false;
+}
+
+bool PushBack(const Datatype& x)
+{
+	if (Full() && Grow())
+		return true;
+	_Array[_Slot(_Count)] = x;
+	_Count++;
+	return false;
+}
+
+bool operator += (const Datatype& x)
+{
+	return PushBack(x);
+}
+
+bool PopFront(Datatype& rtn) noexcept
+{
+	if (Empty())
+		return true;
+	rtn = (Datatype&&)(_Array[_Head]);
+	_Head = (_Head + 1) & (_Length - 1);
+	_Count--;
+	return false;
+}
+
+bool PopBack(Datatype& rtn) noexcept
+{
+	if (Empty())
+		return true;
+	_Count--;
+	rtn = (Datatype&&)(_Array[_Slot(_Count)]);
+	return false;
+}
+
+/// NOTE: appends 'count' elements, copied a span at a time, returns true if the Deque can't grow to hold them
+bool PushBack(const Datatype* const elements, const u32 count)
+{
+	const u64 required = (u64)(_Count) + count;
+	if (required > MAXIMUM_CAPACITY)
+		return true;
+	if (required > _Length && Grow((u32)(required)))
+		return true;
+	const u32 tail  = _Slot(_Count);
+	const u32 first = _Length - tail < count ? _Length - tail : count;
+	for (u32 i = 0; i < first; i++)
+		_Array[tail + i] = elements[i];
+	for (u32 i = first; i < count; i++)
+		_Array[i - first] = elements[i];
+	_Count += count;
+	return false;
+}
+
+/// NOTE: moves up to 'count' elements off the front into 'rtn' a span at a time
+/// RTRN: the number of elements popped
+u32 PopFront(Datatype* const rtn, const u32 count) noexcept
+{
+	const u32 popped = count < _Count ? count : _Count;
+	const u32 first  = _Length - _Head < popped ? _Length - _Head : popped;
+	for (u32 i = 0; i < first; i++)
+		rtn[i] = (Datatype&&)(_Array[_Head + i]);
+	for (u32 i = first; i < popped; i++)
+		rtn[i] = (Datatype&&)(_Array[i - first]);
+	if (popped)
+		_Head = (_Head + popped) & (_Length - 1);
+	_Count -= popped;
+	return popped;
+}
+
+void Erase(void) noexcept
+{
+	_Head  = 0;
+	_Count = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEQUE OPERATION METHODS
+public:
+
+bool Equals(const Deque& that) const noexcept
+{
+	if (this->_Count != that._Count)
+		return false;
+	for (u32 i = 0; i < _Count; i++)
+		if (! (this->operator [] (i) == that[i]))
+			return false;
+	return true;
+}
+
+bool operator == (const Deque& that) const noexcept
+{
+	return this->Equals(that);
+}
+
+/// NOTE: returns the opposite of operator ==
+bool operator != (const Deque& that) const noexcept
+{
+	return ! this->operator == (that);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// INDEXING HELPER METHODS
+private:
+
+u32 _Slot(const u32 index) const noexcept
+{
+	return (_Head + index) & (_Length - 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end DEQUE_HPP
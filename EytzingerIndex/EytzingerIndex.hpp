@@ -0,0 +1,267 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef EYTZINGERINDEX_HPP
+#define EYTZINGERINDEX_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Bits.hpp"
+#include "Sort.hpp"
+#include "Array.hpp"
+#include "Vector.hpp"
+
+#include <cstdint>     // exclusively for std::uintptr_t
+#include <new>         // exclusively for std::align_val_t & std::nothrow
+#include <type_traits> // exclusively for std::is_trivially_copyable
+
+namespace alt // EytzingerIndex belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: EytzingerIndex is a read-only copy of a sorted range laid out in Eytzinger (breadth first) order: the root of
+/// the implicit search tree is slot 1 & the children of slot k are slots 2k & 2k + 1.  A binary search over a sorted
+/// array touches a new cache line at almost every level once the array outgrows the cache, but here the top levels
+/// share a handful of hot lines, & the 2^L descendants of slot k which a search reaches L levels later are contiguous.
+/// Since the slots are cache line aligned, LowerBound() prefetches the line holding them while it compares slot k, so
+/// each miss overlaps with the next few levels of the search rather than stalling it.
+///
+/// NOTE: LowerBound() returns the same index as alt::LowerBound() over the original sorted range, the conversion from
+/// a slot back to its sorted index is a few arithmetic instructions.
+///
+/// WARN: the keys must be trivially copyable, & the range it's built from must be sorted by 'Compare'.
+template < typename Datatype, class Compare = alt::Less<Datatype> >
+class EytzingerIndex
+{
+static_assert(std::is_trivially_copyable<Datatype>::value, "alt::EytzingerIndex keys must be trivially copyable");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+private:
+
+READONLY u64 CACHE_LINE = 64;
+
+/// NOTE: the number of slots prefetched at once, the descendants of a slot this many levels down fill a cache line
+READONLY u64 BLOCK = sizeof(Datatype) > CACHE_LINE / 2 ? 1 :
+                     sizeof(Datatype) > CACHE_LINE / 4 ? 2 :
+                     sizeof(Datatype) > CACHE_LINE / 8 ? 4 :
+                     sizeof(Datatype) > CACHE_LINE / 16 ? 8 : 16;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	Datatype* _Tree;    // The keys in Eytzinger order from slot 1, slot 0 is unused
+	i64       _Count;   // The number of keys
+	i64       _Last;    // The number of keys on the bottom level of the tree
+	u32       _Height;  // The number of levels in the tree
+	Compare   _Less;
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONSTRUCTORS & DESTRUCTOR
+public:
+
+EytzingerIndex() noexcept:
+	_Tree(nullptr),
+	_Count(0),
+	_Last(0),
+	_Height(0),
+	_Less()
+{}
+
+/// NOTE: throws alt::MallocFailure if the tree can't be allocated
+explicit EytzingerIndex(const Datatype* const sorted, const i64 count, const Compare& less = Compare {}):
+	_Tree(nullptr),
+	_Count(0),
+	_Last(0),
+	_Height(0),
+	_Less(less)
+{
+	_Build(sorted, count);
+}
+
+template <i64 _Capacity>
+explicit EytzingerIndex(const Array<Datatype, _Capacity>& sorted, const Compare& less = Compare {}):
+	EytzingerIndex(sorted.Data(), sorted.Count(), less)
+{}
+
+explicit EytzingerIndex(const Vector<Datatype>& sorted, const Compare& less = Compare {}):
+	EytzingerIndex(sorted.Data(), sorted.Size(), less)
+{}
+
+EytzingerIndex(const EytzingerIndex& copy) = delete;
+EytzingerIndex& operator = (const EytzingerIndex& copy) = delete;
+
+EytzingerIndex(EytzingerIndex&& move) noexcept:
+	_Tree(move._Tree),
+	_Count(move._Count),
+	_Last(move._Last),
+	_Height(move._Height),
+	_Less(move._Less)
+{
+	move._Tree   = nullptr;
+	move._Count  = 0;
+	move._Last   = 0;
+	move._Height = 0;
+}
+
+EytzingerIndex& operator = (EytzingerIndex&& move) noexcept
+{
+	if (this == &move)
+		return *this;
+	_Free();
+	_Tree   = move._Tree;
+	_Count  = move._Count;
+	_Last   = move._Last;
+	_Height = move._Height;
+	_Less   = move._Less;
+	move._Tree   = nullptr;
+	move._Count  = 0;
+	move._Last   = 0;
+	move._Height = 0;
+	return *this;
+}
+
+~EytzingerIndex() noexcept
+{
+	_Free();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE ACCESSORS
+public:
+
+i64 Count(void) const noexcept
+{
+	return _Count;
+}
+
+bool Empty(void) const noexcept
+{
+	return _Count == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEARCH METHODS
+public:
+
+/// RTRN: the index in the original sorted range of the first key which is not less than 'key', or Count() if none
+i64 LowerBound(const Datatype& key) const noexcept
+{
+	const u64 slot = _Descend(key);
+	return slot ? _Rank(slot) : _Count;
+}
+
+/// RTRN: the index in the original sorted range of a key equivalent to 'key', or -1 if there is none
+i64 IndexOf(const Datatype& key) const noexcept
+{
+	const u64 slot = _Descend(key);
+	if (! slot || _Less(key, _Tree[slot]))
+		return -1;
+	return _Rank(slot);
+}
+
+bool Contains(const Datatype& key) const noexcept
+{
+	const u64 slot = _Descend(key);
+	return slot && ! _Less(key, _Tree[slot]);
+}
+
+/// NOTE: returns the first key which is not less than 'key', or nullptr if there is none
+const Datatype* Find(const Datatype& key) const noexcept
+{
+	const u64 slot = _Descend(key);
+	return slot ? _Tree + slot : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// HELPER METHODS
+private:
+
+/// NOTE: takes the address as an integer, since the slots prefetched near the bottom of the tree are far past the end
+/// of _Tree, where even forming a pointer is undefined.  A prefetch never faults, so the address needn't be mapped.
+static void _Prefetch(const std::uintptr_t address) noexcept
+{
+#if defined(_MSC_VER)
+	_mm_prefetch((const char*)(address), _MM_HINT_T0);
+#else
+	__builtin_prefetch((const void*)(address));
+#endif
+}
+
+/// NOTE: walks down the tree, turning right past every key less than 'key', & prefetches the cache line holding the
+/// descendants of the current slot a few levels down.  The walk ends past a leaf, & the slot of the lower bound is
+/// the last one where it turned left, found by stripping the trailing right turns (1 bits) & then that left turn.
+/// RTRN: the slot of the lower bound, or 0 if every key is less than 'key'
+u64 _Descend(const Datatype& key) const noexcept
+{
+	u64 slot = 1;
+	while (slot <= (u64)(_Count))
+	{
+		_Prefetch((std::uintptr_t)(_Tree) + slot * BLOCK * sizeof(Datatype));
+		slot = 2 * slot + (u64)(_Less(_Tree[slot], key));
+	}
+	return slot >> (alt::CountTrailingZeros(~slot) + 1);
+}
+
+/// NOTE: the in-order position of a slot in a perfect tree of _Height levels is (2 * (slot - 2^depth) + 1) *
+/// 2^(_Height - 1 - depth) - 1.  The real tree is only missing bottom level slots past _Last, which sit at the even
+/// positions from 2 * _Last on, so the sorted index is that position less the missing slots before it.
+i64 _Rank(const u64 slot) const noexcept
+{
+	const u32 depth   = alt::Log2Floor(slot);
+	const i64 perfect = (i64)(((2 * (slot - ((u64)(1) << depth)) + 1) << (_Height - 1 - depth)) - 1);
+	const i64 missing = (perfect + 1) / 2 - _Last;
+	return missing > 0 ? perfect - missing : perfect;
+}
+
+void _Build(const Datatype* const sorted, const i64 count)
+{
+	if (sorted == nullptr || count <= 0)
+		return;
+	_Tree = (Datatype*)(::operator new(sizeof(Datatype) * (count + 1), std::align_val_t(CACHE_LINE), std::nothrow));
+	if (_Tree == nullptr)
+		throw alt::MallocFailure {};
+	_Count  = count;
+	_Height = alt::Log2Floor((u64)(count)) + 1;
+	_Last   = count - (((i64)(1) << (_Height - 1)) - 1);
+	for (i64 slot = 1; slot <= count; slot++)
+		_Tree[slot] = sorted[_Rank((u64)(slot))];
+}
+
+void _Free(void) noexcept
+{
+	if (_Tree)
+	{
+		::operator delete(_Tree, std::align_val_t(CACHE_LINE));
+		_Tree = nullptr;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end EYTZINGERINDEX_HPP
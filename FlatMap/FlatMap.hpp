@@ -0,0 +1,271 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef FLATMAP_HPP
+#define FLATMAP_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Sort.hpp"
+#include "Vector.hpp"
+
+namespace alt // FlatMap belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: FlatMap is an associative container kept as two parallel sorted alt::Vectors, one of keys and one of values.
+/// Lookups are a branchless binary search over the dense key array, so small hot tables stay within a handful of cache
+/// lines, at the cost of O(n) single-element insertion and removal.  Prefer InsertBatch() for bulk updates.
+template < typename Keytype, typename Valuetype, class Compare = alt::Less<Keytype> >
+class FlatMap
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	alt::Vector<Keytype>   _Keys;
+	alt::Vector<Valuetype> _Values;
+	Compare                _Less;
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+FlatMap() noexcept:
+	_Keys(),
+	_Values(),
+	_Less()
+{}
+
+~FlatMap() noexcept
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+/// OVERLOADED CONSTRUCTORS
+public:
+
+/// NOTE: sorts & dedupes the given pairs, when a key repeats the last value given for it wins
+explicit FlatMap(const Keytype* const keys, const Valuetype* const values, const u32 count):
+	_Keys(),
+	_Values(),
+	_Less()
+{
+	InsertBatch(keys, values, count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+u32 Count(void) const noexcept
+{
+	return _Keys.Size();
+}
+
+u32 Capacity(void) const noexcept
+{
+	return _Keys.Capacity();
+}
+
+bool Empty(void) const noexcept
+{
+	return _Keys.Empty();
+}
+
+/// NOTE: returns true if the map can already hold 'capacity' pairs
+bool Reserve(const u32 capacity)
+{
+	if (capacity <= _Keys.Capacity() && capacity <= _Values.Capacity())
+		return true;
+	if (capacity > _Keys.Capacity())
+		_Keys.Grow(capacity);
+	if (capacity > _Values.Capacity())
+		_Values.Grow(capacity);
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+/// NOTE: the keys in ascending order, parallel to Values()
+const Keytype* Keys(void) const noexcept
+{
+	return _Keys.Data();
+}
+
+const Valuetype* Values(void) const noexcept
+{
+	return _Values.Data();
+}
+
+/// WARN: writing through this pointer is safe, the order of the map only depends upon its keys
+Valuetype* Values(void) noexcept
+{
+	return _Values.Data();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEARCH METHODS
+public:
+
+/// RTRN: the index of the first key which is not less than 'key', which is Count() if there is none
+u32 LowerBound(const Keytype& key) const
+{
+	return (u32)(alt::LowerBound(_Keys.Data(), _Keys.Size(), key, _Less));
+}
+
+i64 IndexOf(const Keytype& key) const
+{
+	const u32 index = LowerBound(key);
+	if (index == _Keys.Size() || _Less(key, _Keys[index]))
+		return -1;
+	return index;
+}
+
+bool Contains(const Keytype& key) const
+{
+	return IndexOf(key) >= 0;
+}
+
+/// NOTE: returns nullptr if 'key' is not in the map
+const Valuetype* Find(const Keytype& key) const
+{
+	const i64 index = IndexOf(key);
+	return index < 0 ? nullptr : _Values.Data() + index;
+}
+
+/// NOTE: returns nullptr if 'key' is not in the map
+Valuetype* Find(const Keytype& key)
+{
+	const i64 index = IndexOf(key);
+	return index < 0 ? nullptr : _Values.Data() + index;
+}
+
+/// NOTE: throws alt::InvalidIndex if 'key' is not in the map
+const Valuetype& At(const Keytype& key) const
+{
+	const Valuetype* const value = Find(key);
+	if (value == nullptr)
+		throw alt::InvalidIndex();
+	return *value;
+}
+
+/// NOTE: throws alt::InvalidIndex if 'key' is not in the map
+Valuetype& At(const Keytype& key)
+{
+	Valuetype* const value = Find(key);
+	if (value == nullptr)
+		throw alt::InvalidIndex();
+	return *value;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: overwrites the value of 'key' if it is already in the map
+/// RTRN: true if either Vector could not grow, in which case the map is left untouched
+bool Insert(const Keytype& key, const Valuetype& value)
+{
+	const u32 index = LowerBound(key);
+	if (index < _Keys.Size() && ! _Less(key, _Keys[index]))
+	{
+		_Values[index] = value;
+		return false;
+	}
+	// grow both before inserting either, so a failed (or throwing) Grow() can't leave _Keys longer than _Values
+	if ((_Keys.Full() && _Keys.Grow()) || (_Values.Full() && _Values.Grow()))
+		return true;
+	return _Keys.Insert(index, key) || _Values.Insert(index, value);
+}
+
+/// NOTE: returns true if 'key' is not in the map
+bool Remove(const Keytype& key)
+{
+	const i64 index = IndexOf(key);
+	if (index < 0)
+		return true;
+	return _Keys.Remove((u32)(index)) || _Values.Remove((u32)(index));
+}
+
+/// NOTE: sorts & dedupes the batch (the last value given for a repeated key wins), then merges it with the map in a
+/// single linear pass into freshly sized storage, which is O(n + m log m) rather than m separate O(n) insertions
+/// RTRN: true if the sort buffer could not be allocated, in which case the map is left untouched
+bool InsertBatch(const Keytype* const keys, const Valuetype* const values, const u32 count)
+{
+	if (count == 0 || keys == nullptr || values == nullptr)
+		return false;
+	alt::Vector<u32> order(count);
+	for (u32 i = 0; i < count; i++)
+		order.PushBack(i);
+	const Compare& less = _Less;
+	if (order.StableSort([keys, &less](const u32& lhs, const u32& rhs) -> bool
+			{ return less(keys[lhs], keys[rhs]); }))
+		return true;
+
+	alt::Vector<Keytype>   mergedKeys(_Keys.Size() + count);
+	alt::Vector<Valuetype> mergedValues(_Keys.Size() + count);
+	u32 i = 0;
+	u32 j = 0;
+	while (j < count)
+	{
+		// skip to the last of a run of equal batch keys
+		while (j + 1 < count && ! _Less(keys[order[j]], keys[order[j + 1]]))
+			j++;
+		const Keytype& key = keys[order[j]];
+		while (i < _Keys.Size() && _Less(_Keys[i], key))
+		{
+			mergedKeys.PushBack(_Keys[i]);
+			mergedValues.PushBack(_Values[i]);
+			i++;
+		}
+		if (i < _Keys.Size() && ! _Less(key, _Keys[i]))
+			i++;
+		mergedKeys.PushBack(key);
+		mergedValues.PushBack(values[order[j]]);
+		j++;
+	}
+	for (; i < _Keys.Size(); i++)
+	{
+		mergedKeys.PushBack(_Keys[i]);
+		mergedValues.PushBack(_Values[i]);
+	}
+	_Keys   = (alt::Vector<Keytype>&&)(mergedKeys);
+	_Values = (alt::Vector<Valuetype>&&)(mergedValues);
+	return false;
+}
+
+void Erase(void) noexcept
+{
+	_Keys.Erase();
+	_Values.Erase();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end FLATMAP_HPP
@@ -0,0 +1,204 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef FLATSET_HPP
+#define FLATSET_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Sort.hpp"
+#include "Vector.hpp"
+
+#include <type_traits> // exclusively for std::is_same
+
+namespace alt // FlatSet belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: FlatSet is the key-only counterpart of alt::FlatMap, a single sorted & deduplicated alt::Vector of keys
+/// searched with a branchless binary search.
+template < typename Keytype, class Compare = alt::Less<Keytype> >
+class FlatSet
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	alt::Vector<Keytype> _Keys;
+	Compare              _Less;
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+FlatSet() noexcept:
+	_Keys(),
+	_Less()
+{}
+
+~FlatSet() noexcept
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+/// OVERLOADED CONSTRUCTORS
+public:
+
+/// NOTE: sorts & dedupes the given keys
+explicit FlatSet(const Keytype* const keys, const u32 count):
+	_Keys(),
+	_Less()
+{
+	InsertBatch(keys, count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+u32 Count(void) const noexcept
+{
+	return _Keys.Size();
+}
+
+u32 Capacity(void) const noexcept
+{
+	return _Keys.Capacity();
+}
+
+bool Empty(void) const noexcept
+{
+	return _Keys.Empty();
+}
+
+/// NOTE: returns true if the set can already hold 'capacity' keys
+bool Reserve(const u32 capacity)
+{
+	if (capacity <= _Keys.Capacity())
+		return true;
+	return _Keys.Grow(capacity);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+/// NOTE: the keys in ascending order
+const Keytype* Keys(void) const noexcept
+{
+	return _Keys.Data();
+}
+
+const Keytype& operator [] (const u32 index) const
+{
+	return _Keys[index];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEARCH METHODS
+public:
+
+/// RTRN: the index of the first key which is not less than 'key', which is Count() if there is none
+u32 LowerBound(const Keytype& key) const
+{
+	return (u32)(alt::LowerBound(_Keys.Data(), _Keys.Size(), key, _Less));
+}
+
+i64 IndexOf(const Keytype& key) const
+{
+	const u32 index = LowerBound(key);
+	if (index == _Keys.Size() || _Less(key, _Keys[index]))
+		return -1;
+	return index;
+}
+
+bool Contains(const Keytype& key) const
+{
+	return IndexOf(key) >= 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: returns true if 'key' is already in the set
+bool Insert(const Keytype& key)
+{
+	const u32 index = LowerBound(key);
+	if (index < _Keys.Size() && ! _Less(key, _Keys[index]))
+		return true;
+	return _Keys.Insert(index, key);
+}
+
+/// NOTE: returns true if 'key' is not in the set
+bool Remove(const Keytype& key)
+{
+	const i64 index = IndexOf(key);
+	if (index < 0)
+		return true;
+	return _Keys.Remove((u32)(index));
+}
+
+/// NOTE: sorts & dedupes the batch (radix sorting it under the default comparator), then merges it with the set in a
+/// single linear pass into freshly sized storage
+bool InsertBatch(const Keytype* const keys, const u32 count)
+{
+	if (count == 0 || keys == nullptr)
+		return false;
+	alt::Vector<Keytype> batch(count);
+	for (u32 i = 0; i < count; i++)
+		batch.PushBack(keys[i]);
+	if constexpr (std::is_same<Compare, alt::Less<Keytype>>::value)
+		batch.Sort();
+	else
+		batch.Sort(_Less);
+
+	alt::Vector<Keytype> merged(_Keys.Size() + count);
+	u32 i = 0;
+	for (u32 j = 0; j < count; j++)
+	{
+		if (j + 1 < count && ! _Less(batch[j], batch[j + 1]))
+			continue;
+		while (i < _Keys.Size() && _Less(_Keys[i], batch[j]))
+			merged.PushBack(_Keys[i++]);
+		if (i < _Keys.Size() && ! _Less(batch[j], _Keys[i]))
+			i++;
+		merged.PushBack(batch[j]);
+	}
+	for (; i < _Keys.Size(); i++)
+		merged.PushBack(_Keys[i]);
+	_Keys = (alt::Vector<Keytype>&&)(merged);
+	return false;
+}
+
+void Erase(void) noexcept
+{
+	_Keys.Erase();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end FLATSET_HPP
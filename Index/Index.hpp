@@ -191,6 +191,7 @@ inline Index::Index(const i64 value) noexcept:
 inline Index& Index::operator = (const i64 value) noexcept
 {
 	_Value = value;
+	return *this;
 }
 
 inline Index::Index(const Index& copy) noexcept:
@@ -200,6 +201,7 @@ inline Index::Index(const Index& copy) noexcept:
 inline Index& Index::operator = (const Index& copy) noexcept
 {
 	_Value = copy._Value;
+	return *this;
 }
 
 inline Index::Index(Index&& move) noexcept:
@@ -212,6 +214,7 @@ inline Index& Index::operator = (Index&& move) noexcept
 {
 	_Value = move._Value;
 	move._Value = -1;
+	return *this;
 }
 
 inline Index::~Index() noexcept
@@ -20,6 +20,17 @@
 /// CREATED: 2021.01.06
 
 #include <iostream>
+#include <atomic>      // exclusively for std::atomic
+#include <cstdio>      // exclusively for std::tmpfile() & fileno()
+#include <string>      // exclusively for std::string
+#include <thread>      // exclusively for std::thread
+#include <limits>      // exclusively for std::numeric_limits
+#include <type_traits> // exclusively for std::is_trivially_destructible & std::is_trivially_copyable
+#ifdef _MSC_VER
+#include <io.h>        // exclusively for ::_lseeki64() & ::_chsize_s()
+#else
+#include <unistd.h>    // exclusively for ::lseek() & ::ftruncate()
+#endif // _MSC_VER
 
 #include "Keywords.hpp"
 #include "Types.hpp"
@@ -28,8 +39,35 @@
 
 #include "Allocator.hpp"
 
+#include "Sort.hpp"
+
 #include "Array.hpp"
+#include "RingArray.hpp"
+#include "ArrayMath.hpp"
 #include "Vector.hpp"
+#include "VectorStats.hpp"
+#include "VectorGrowth.hpp"
+#include "CowVector.hpp"
+#include "SegmentedVector.hpp"
+#include "SoAVector.hpp"
+#include "PersistentVector.hpp"
+#include "ConcurrentVector.hpp"
+#include "BitVector.hpp"
+#include "StaticBitset.hpp"
+#include "PackedIntVector.hpp"
+#include "Deque.hpp"
+#include "SpscQueue.hpp"
+#include "MpmcQueue.hpp"
+
+#include "FlatMap.hpp"
+#include "FlatSet.hpp"
+#include "SlotMap.hpp"
+#include "StaticHashMap.hpp"
+#include "EytzingerIndex.hpp"
+
+#include "View.hpp"
+
+#include "Serialize.hpp"
 
 #include "UniquePointer.hpp"
 #include "SharedPointer.hpp"
@@ -39,6 +77,7 @@
 #include "Index.hpp"
 
 #include "u128.hpp"
+#include "u128Serialize.hpp"
 
 READONLY STR TAB  = "        ";
 READONLY STR INFO = "INFO:   ";
@@ -46,16 +85,41 @@ READONLY STR WARN = "WARN:   ";
 READONLY STR FAIL = "FAIL:   ";
 READONLY STR EXIT = "EXIT:   ";
 
-void TestExceptions    ( void );
-void TestAllocator     ( void );
-void TestArray         ( void );
-void TestVector        ( void );
-void TestUniquePointer ( void );
-void TestSharedPointer ( void );
-void TestUniqueArray   ( void );
-void TestSharedArray   ( void );
-void TestIndex         ( void );
-void TestU128          ( void );
+void Check(const bool condition, const STR const msg);
+
+void TestExceptions       ( void );
+void TestAllocator        ( void );
+void TestSort             ( void );
+void TestArray            ( void );
+void TestRingArray        ( void );
+void TestArrayMath        ( void );
+void TestVector           ( void );
+void TestVectorStats      ( void );
+void TestVectorGrowth     ( void );
+void TestCowVector        ( void );
+void TestSegmentedVector  ( void );
+void TestSoAVector        ( void );
+void TestPersistentVector ( void );
+void TestConcurrentVector ( void );
+void TestBitVector        ( void );
+void TestStaticBitset     ( void );
+void TestPackedIntVector  ( void );
+void TestDeque            ( void );
+void TestSpscQueue        ( void );
+void TestMpmcQueue        ( void );
+void TestFlatMap          ( void );
+void TestFlatSet          ( void );
+void TestSlotMap          ( void );
+void TestStaticHashMap    ( void );
+void TestEytzingerIndex   ( void );
+void TestView             ( void );
+void TestSerialize        ( void );
+void TestUniquePointer    ( void );
+void TestSharedPointer    ( void );
+void TestUniqueArray      ( void );
+void TestSharedArray      ( void );
+void TestIndex            ( void );
+void TestU128             ( void );
 
 int main(const int argc, const STR const argv[], const STR const envp[])
 {
@@ -64,8 +128,31 @@ int main(const int argc, const STR const argv[], const STR const envp[])
     {
         TestExceptions();
         TestAllocator();
+        TestSort();
         TestArray();
+        TestRingArray();
+        TestArrayMath();
         TestVector();
+        TestVectorStats();
+        TestVectorGrowth();
+        TestCowVector();
+        TestSegmentedVector();
+        TestSoAVector();
+        TestPersistentVector();
+        TestConcurrentVector();
+        TestBitVector();
+        TestStaticBitset();
+        TestPackedIntVector();
+        TestDeque();
+        TestSpscQueue();
+        TestMpmcQueue();
+        TestFlatMap();
+        TestFlatSet();
+        TestSlotMap();
+        TestStaticHashMap();
+        TestEytzingerIndex();
+        TestView();
+        TestSerialize();
         TestUniquePointer();
         TestSharedPointer();
         TestUniqueArray();
@@ -88,6 +175,14 @@ int main(const int argc, const STR const argv[], const STR const envp[])
     return EXIT_SUCCESS;
 }
 
+void Check(const bool condition, const STR const msg)
+{
+    if (condition)
+        return;
+    std::cout << FAIL << msg << std::endl;
+    throw alt::Except { msg };
+}
+
 void TestExceptions(void)
 {
     using namespace alt;
@@ -108,26 +203,1181 @@ void TestAllocator(void)
     std::cout << INFO << "Allocator Test Passed" << std::endl << std::endl;
 }
 
+void TestSort(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning Sort Test" << std::endl;
+
+    u64 seed = 88172645463325252ull;
+    auto random = [&seed](void) -> u64
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return seed;
+    };
+
+    // every sorting network, by the 0-1 principle
+    for (i64 n = 2; n <= SORT_NETWORK_THRESHOLD; n++)
+        for (u32 bits = 0; bits < (1u << n); bits++)
+        {
+            i32 keys[SORT_NETWORK_THRESHOLD];
+            for (i64 i = 0; i < n; i++)
+                keys[i] = (bits >> i) & 1;
+            Sort(keys, n, Less<i32> {});
+            Check(IsSorted(keys, n), "sorting network");
+        }
+
+    // radix sorted keys
+    Vector<i32> ints(4096);
+    Vector<f64> floats(4096);
+    Vector<u128> wides(4096);
+    for (u32 i = 0; i < 4096; i++)
+    {
+        ints.PushBack((i32)(random()));
+        floats.PushBack((f64)((i64)(random())) / 1024.0);
+        wides.PushBack(u128 { random() & 0xFF, random() });
+    }
+    ints.Sort();
+    floats.Sort();
+    wides.Sort();
+    Check(ints.IsSorted(),   "Vector<i32>::Sort()");
+    Check(floats.IsSorted(), "Vector<f64>::Sort()");
+    Check(wides.IsSorted(),  "Vector<u128>::Sort()");
+
+    // pattern-defeating quicksort on random, sorted, reversed, & few unique keys
+    Vector<u32> keys(10000);
+    for (u32 i = 0; i < 10000; i++)
+        keys.PushBack((u32)(random()));
+    keys.Sort(Greater<u32> {});
+    Check(keys.IsSorted(Greater<u32> {}), "Vector<u32>::Sort(Greater) on random keys");
+    keys.Sort(Greater<u32> {});
+    Check(keys.IsSorted(Greater<u32> {}), "Vector<u32>::Sort(Greater) on sorted keys");
+    keys.Sort(Less<u32> {});
+    Check(keys.IsSorted(), "Vector<u32>::Sort(Less) on reversed keys");
+    for (u32 i = 0; i < 10000; i++)
+        keys[i] = (u32)(random() % 4);
+    keys.Sort(Less<u32> {});
+    Check(keys.IsSorted(), "Vector<u32>::Sort(Less) on few unique keys");
+
+    // stable sort keeps equal keys in their original order
+    Vector<u64> pairs(1000);
+    for (u32 i = 0; i < 1000; i++)
+        pairs.PushBack(((random() % 16) << 32) | i);
+    auto byKey = [](const u64& lhs, const u64& rhs) -> bool { return (lhs >> 32) < (rhs >> 32); };
+    Check(! pairs.StableSort(byKey), "Vector<u64>::StableSort() allocation");
+    Check(pairs.IsSorted(), "Vector<u64>::StableSort() stability");
+
+    Array<i32, 16> small;
+    for (i32 i = 16; i > 0; i--)
+        small.Enqueue(i);
+    small.Sort();
+    Check(small.IsSorted() && small[0] == 1 && small[15] == 16, "Array<i32, 16>::Sort()");
+
+    std::cout << INFO << "Sort Test Passed" << std::endl << std::endl;
+}
+
 void TestArray(void)
 {
     using namespace alt;
     std::cout << INFO << "Beginning Array Test" << std::endl;
 
-    /// TODO: write tests here
+    constexpr Array<u32, 16> squares = []()
+    {
+        Array<u32, 16> table;
+        for (u32 i = 16; i > 0; i--)
+            table.Enqueue((i - 1) * (i - 1));
+        table.HeapSort();
+        return table;
+    }();
+    static_assert(std::is_trivially_destructible<Array<u32, 16>>::value, "Array is a literal type");
+    static_assert(squares.Count() == 16 && squares.At(3) == 9 && squares[15] == 225, "Array built at compile time");
+    static_assert(squares.IsSorted() && squares.IndexOf(49) == 7 && squares.IndexOf(50) == -1, "constexpr Array search");
+    constexpr Array<u32, 16> copy = squares;
+    static_assert(copy.Equals(squares) && copy == squares, "constexpr Array copy");
+
+    Array<u32, 16> runtime(squares);
+    runtime.Remove(0);
+    Check(runtime.Count() == 15 && runtime[0] == 1 && runtime != squares, "Array copy is independent");
+    Array<u32, 16> moved((Array<u32, 16>&&)(runtime));
+    Check(moved.Count() == 15 && moved.PeekBack() == 225, "Array move");
+    moved = squares;
+    Check(moved == squares, "Array assignment");
+
+    static_assert(sizeof(Array<u8, 8>) == 9 && sizeof(Array<u16, 3>) == 8, "Array uses the narrowest count");
+    static_assert(std::is_trivially_copyable<Array<u32, 16>>::value, "Array of trivially copyable elements");
+    static_assert(! std::is_trivially_copyable<Array<std::string, 4>>::value, "Array of std::string");
+    Array<std::string, 4> names;
+    names.Enqueue("alpha");
+    names.Enqueue("beta");
+    Array<std::string, 4> taken((Array<std::string, 4>&&)(names));
+    Check(taken.Count() == 2 && taken[1] == "beta" && names.Count() == -1, "Array move of non-trivial elements");
+    names = taken;
+    Check(names == taken && names[0] == "alpha", "Array copy of non-trivial elements");
 
     std::cout << INFO << "Array Test Passed" << std::endl << std::endl;
 }
 
+void TestRingArray(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning RingArray Test" << std::endl;
+
+    RingArray<i32, 4> ring;
+    Check(! ring.Enqueue(2) && ! ring.Enqueue(3) && ! ring.Push(1) && ! ring.Push(0), "RingArray::Push() & Enqueue()");
+    Check(ring.Full() && ring.Enqueue(4) && ring.Push(-1), "RingArray rejects pushes when full");
+    Check(ring.Peek() == 0 && ring.PeekBack() == 3 && ring[1] == 1 && ring.IndexOf(2) == 2, "RingArray order");
+
+    i32 x = 0;
+    for (i32 i = 4; i < 100; i++)
+    {
+        ring.Pop(x);
+        ring += i;
+    }
+    Check(x == 95 && ring.Count() == 4 && ring.Peek() == 96 && ring.PeekBack() == 99, "RingArray wraps around");
+    Check(! ring.PopBack(x) && x == 99 && ring.Count() == 3, "RingArray::PopBack()");
+    ring.Erase();
+    Check(ring.Empty() && ring.Pop(x) && ring.PopBack(x), "RingArray::Erase()");
+
+    constexpr RingArray<u8, 8> window = []()
+    {
+        RingArray<u8, 8> ring;
+        for (u8 i = 0; i < 20; i++)
+        {
+            u8 dropped = 0;
+            if (ring.Full())
+                ring.Pop(dropped);
+            ring.Enqueue(i);
+        }
+        return ring;
+    }();
+    static_assert(window.Count() == 8 && window.Peek() == 12 && window.PeekBack() == 19, "constexpr RingArray");
+
+    std::cout << INFO << "RingArray Test Passed" << std::endl << std::endl;
+}
+
+void TestArrayMath(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning ArrayMath Test" << std::endl;
+
+    Array<f32, 19> a;
+    Array<f32, 19> b;
+    for (i32 i = 0; i < 19; i++)
+    {
+        a.Enqueue((f32)(i));
+        b.Enqueue((f32)(2 * i + 1));
+    }
+    Check(alignof(Array<f32, 19>) == SIMD_REGISTER_BYTES && alignof(Array<u8, 8>) == 1,
+          "Array storage alignment doesn't depend on the target flags");
+
+    const Array<f32, 19> sum = a + b;
+    const Array<f32, 19> quotient = b / (a + 1.0f);
+    bool ok = sum.Count() == 19 && quotient.Count() == 19;
+    for (i32 i = 0; i < 19; i++)
+        ok = ok && sum[i] == 3 * i + 1 && (b - a)[i] == i + 1 && (a * b)[i] == i * (2 * i + 1) &&
+             quotient[i] == (f32)(2 * i + 1) / (f32)(i + 1) && (a * 2.0f)[i] == 2 * i;
+    Check(ok, "ArrayMath elementwise + - * /");
+
+    Array<f32, 19> holes = b;
+    holes[3]  = std::numeric_limits<f32>::quiet_NaN();
+    holes[17] = std::numeric_limits<f32>::quiet_NaN();
+    const Array<f32, 19> low  = Min(a, holes);
+    const Array<f32, 19> high = Max(a, holes);
+    Check(low[3] != low[3] && low[17] != low[17] && high[3] != high[3] && high[17] != high[17] && low[2] == 2.0f,
+          "ArrayMath Min() & Max() treat NaN alike in registers & tails");
+
+    const Array<f32, 19> fused = Fma(a, b, sum);
+    ok = fused.Count() == 19;
+    for (i32 i = 0; i < 19; i++)
+        ok = ok && fused[i] == i * (2 * i + 1) + 3 * i + 1;
+    Check(ok, "ArrayMath Fma()");
+    Check(Dot(a, b) == 4389.0f && Sum(a) == 171.0f && Min(b) == 1.0f && Max(b) == 37.0f, "ArrayMath reductions");
+
+    Array<f64, 7> x;
+    Array<f64, 7> y;
+    for (f64 v : {3.0, -1.0, 4.0, 1.0, -5.0, 9.0, 2.0})
+        x.Enqueue(v);
+    for (f64 v : {2.0, -1.0, 5.0, 0.0, -5.0, 10.0})
+        y.Enqueue(v);
+    const Array<bool, 7> less  = LessThan(x, y);
+    const Array<bool, 7> more  = GreaterThan(x, y);
+    const Array<bool, 7> equal = EqualTo(x, y);
+    Check(less.Count() == 6 && ! less[0] && ! less[1] && less[2] && ! less[3] && ! less[4] && less[5],
+          "ArrayMath LessThan() over the shorter operand");
+    Check(more[0] && ! more[1] && ! more[2] && more[3] && ! more[4] && ! more[5], "ArrayMath GreaterThan()");
+    Check(! equal[0] && equal[1] && ! equal[2] && ! equal[3] && equal[4] && ! equal[5], "ArrayMath EqualTo()");
+    Check(Min(x) == -5.0 && Max(x) == 9.0 && Min(x, y)[0] == 2.0 && Max(x, y)[5] == 10.0, "ArrayMath Min() & Max()");
+
+    Array<i32, 11> p;
+    Array<i32, 11> q;
+    for (i32 i = 0; i < 11; i++)
+    {
+        p.Enqueue(i - 5);
+        q.Enqueue(5 - 2 * i);
+    }
+    const Array<i32, 11> product = p * q;
+    const Array<i32, 11> ratio   = q / (p + 6);
+    ok = product.Count() == 11;
+    for (i32 i = 0; i < 11; i++)
+        ok = ok && product[i] == (i - 5) * (5 - 2 * i) && ratio[i] == (5 - 2 * i) / (i + 1);
+    Check(ok, "ArrayMath integer elements");
+    const Array<i32, 11> scaled = p * 3 - 1;
+    const Array<i32, 11> halved = q / 2;
+    ok = scaled.Count() == 11 && halved.Count() == 11;
+    for (i32 i = 0; i < 11; i++)
+        ok = ok && scaled[i] == 3 * (i - 5) - 1 && halved[i] == (5 - 2 * i) / 2;
+    Check(ok, "ArrayMath integer scalar overloads");
+    Check(Dot(p, q) == -220 && Sum(q) == -55 && Min(q) == -15 && Max(p) == 5 && LessThan(p, q)[2], "ArrayMath integer reductions");
+
+    Array<u8, 5> bytes;
+    bytes.Enqueue(250);
+    bytes.Enqueue(7);
+    Check((bytes + (u8)(10))[0] == 4 && Sum(bytes) == 1 && Max(bytes) == 250, "ArrayMath scalar fallback wraps like u8");
+
+    std::cout << INFO << "ArrayMath Test Passed" << std::endl << std::endl;
+}
+
 void TestVector(void)
 {
     using namespace alt;
     std::cout << INFO << "Beginning Vector Test" << std::endl;
 
-    /// TODO: write tests here
+    Vector<u32> vec(16);
+    for (u32 i = 0; i < 16; i++)
+        vec.PushBack(i);
+    Check(! vec.SwapRemove(2) && vec[2] == 15 && vec.Size() == 15, "Vector::SwapRemove()");
+    Check(vec.SwapRemove(15), "Vector::SwapRemove() out of bounds");
+    Check(vec.RemoveIf([](const u32& x) { return x % 2 == 1; }) == 8, "Vector::RemoveIf()");
+    Check(vec.Size() == 7 && vec[0] == 0 && vec[1] == 4 && vec[6] == 14, "Vector::RemoveIf() is stable");
+    const u32 indices[]  = { 0, 3, 6 };
+    const u32 unsorted[] = { 3, 0 };
+    Check(vec.RemoveIndices(unsorted, 2) && vec.Size() == 7, "Vector::RemoveIndices() rejects unsorted indices");
+    Check(! vec.RemoveIndices(indices, 3) && vec.Size() == 4, "Vector::RemoveIndices()");
+    Check(vec[0] == 4 && vec[1] == 6 && vec[2] == 10 && vec[3] == 12, "Vector::RemoveIndices() is stable");
 
     std::cout << INFO << "Vector Test Passed" << std::endl << std::endl;
 }
 
+void TestVectorStats(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning VectorStats Test" << std::endl;
+
+    struct Uninstrumented { u32 count; u32 length; Allocator<u64> allocator; u64* array; };
+    Check(sizeof(Vector<u64, Allocator<u64>, NoVectorStats>) == sizeof(Uninstrumented), "NoVectorStats is free");
+    VectorStatsRegistry::Reset();
+    {
+        Vector<u32, Allocator<u32>, VectorStats> hot;
+        hot.Stats().Name("hot");
+        for (u32 i = 0; i < 1000; i++)
+            hot.PushFront(i);
+        const VectorCounters& counters = hot.Stats().Counters();
+        Check(counters._Grows == 10 && counters._HighWater == 1024, "VectorStats counts growth events");
+        Check(counters._ShiftedElements == 999 * 1000 / 2 && counters._Shifts == 1000, "VectorStats counts shifts");
+
+        Vector<u32, Allocator<u32>, VectorStats> copy = hot;
+        Check(copy.Stats().Counters()._BytesCopied == 4000 && copy.Stats().Counters()._Grows == 0,
+            "VectorStats counts copies");
+        copy.Truncate(10);
+        Check(copy.Stats().Counters()._Truncates == 1, "VectorStats counts truncations");
+
+        Vector<u32, Allocator<u32>, VectorStats> cold;
+        cold.Stats().Name("cold");
+        cold.PushBack(1);
+        VectorCounters live[4];
+        Check(! cold.Stats().Flush() && VectorStatsRegistry::Worst(live, 4) == 1 && live[0]._Instances == 1 &&
+              live[0]._HighWater == cold.Capacity() && cold.Stats().Counters().Empty(),
+            "VectorStats::Flush() reports a live Vector");
+        Vector<u32, Allocator<u32>, VectorStats> unnamed;
+        for (u32 i = 0; i < 10; i++)
+            unnamed.PushBack(i);
+        Check(unnamed.RemoveIf([](const u32 x) { return x % 2 == 0; }) == 5 &&
+              unnamed.Stats().Counters()._ShiftedElements == 5, "VectorStats counts RemoveIf() shifts");
+        Check(! unnamed.SwapRemove(0) && ! unnamed.SwapRemove(3) && unnamed.Stats().Counters()._Shifts == 2 &&
+              unnamed.Stats().Counters()._ShiftedElements == 6, "VectorStats counts SwapRemove() moves");
+    }
+    VectorCounters worst[4];
+    Check(VectorStatsRegistry::Worst(worst, 4) == 2, "VectorStatsRegistry skips unnamed Vectors");
+    Check(! std::strcmp(worst[0]._Name, "hot") && worst[0]._Instances == 2 && worst[0]._Truncates == 1,
+        "VectorStatsRegistry merges instances of a call site");
+    Check(! std::strcmp(worst[1]._Name, "cold") && worst[1]._Instances == 1 && worst[0].Cost() > worst[1].Cost(),
+        "VectorStatsRegistry::Worst() counts a flushed Vector once");
+    VectorStatsRegistry::Reset();
+
+    std::cout << INFO << "VectorStats Test Passed" << std::endl << std::endl;
+}
+
+void TestVectorGrowth(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning VectorGrowth Test" << std::endl;
+
+    Check(DoublingGrowth().Next(0, 1, 4) == 2 && DoublingGrowth().Next(64, 65, 4) == 128, "DoublingGrowth");
+    Check(DoublingGrowth().Next(0x80000001u, 0x80000002u, 4) == GROWTH_MAXIMUM_CAPACITY &&
+          DoublingGrowth().Next(GROWTH_MAXIMUM_CAPACITY, GROWTH_MAXIMUM_CAPACITY, 4) == GROWTH_MAXIMUM_CAPACITY,
+        "DoublingGrowth saturates instead of overflowing");
+    Check(ThreeHalvesGrowth().Next(64, 65, 4) == 97 && ThreeHalvesGrowth().Next(2, 1000, 4) == 1000,
+        "ThreeHalvesGrowth");
+    Check(PercentGrowth<25>().Next(100, 101, 4) == 125 && PercentGrowth<25>().Next(1, 2, 4) == 3, "PercentGrowth");
+
+    Check(SizeClassGrowth<>::SizeClass(1) == 16 && SizeClassGrowth<>::SizeClass(100) == 112 &&
+          SizeClassGrowth<>::SizeClass(4097) == 5120, "SizeClassGrowth::SizeClass()");
+    Check(SizeClassGrowth<ThreeHalvesGrowth>().Next(64, 65, 12) == 106, "SizeClassGrowth rounds up to a size class");
+
+    Vector<u32, Allocator<u32>, NoVectorStats, AdaptiveGrowth> adaptive;
+    for (u32 i = 0; i < 1000; i++)
+        adaptive.PushBack(i);
+    Check(adaptive.GrowthPolicy().Factor() == AdaptiveGrowth::ADAPTIVE_MAXIMUM && adaptive[999] == 999,
+        "AdaptiveGrowth speeds up while a Vector keeps growing");
+    adaptive.Truncate(10);
+    Check(adaptive.GrowthPolicy().Factor() == AdaptiveGrowth::ADAPTIVE_MINIMUM, "AdaptiveGrowth resets on Truncate()");
+
+    Vector<u32, Allocator<u32>, NoVectorStats, SizeClassGrowth<AdaptiveGrowth>> classes;
+    for (u32 i = 0; i < 1000; i++)
+        classes.PushBack(i);
+    Check(classes.GrowthPolicy().BasePolicy().Factor() == AdaptiveGrowth::ADAPTIVE_MAXIMUM && classes[999] == 999 &&
+          SizeClassGrowth<>::SizeClass(classes.Capacity() * sizeof(u32)) == classes.Capacity() * sizeof(u32),
+          "SizeClassGrowth over AdaptiveGrowth");
+    classes.Truncate(10);
+    Check(classes.GrowthPolicy().BasePolicy().Factor() == AdaptiveGrowth::ADAPTIVE_MINIMUM,
+          "SizeClassGrowth passes OnShrink() to AdaptiveGrowth");
+
+    Vector<u32, Allocator<u32>, VectorStats, ThreeHalvesGrowth> slow;
+    Vector<u32, Allocator<u32>, VectorStats, DoublingGrowth> fast;
+    for (u32 i = 0; i < 1100; i++)
+    {
+        slow.PushBack(i);
+        fast.PushBack(i);
+    }
+    Check(slow.Stats().Counters()._Grows > fast.Stats().Counters()._Grows && slow.Capacity() < fast.Capacity(),
+        "ThreeHalvesGrowth trades reallocations for memory");
+
+    Vector<u32, Allocator<u32>, VectorStats, DoublingGrowth> tail(4);
+    tail.PushBack(1);
+    tail.PushBack(2);
+    Check(! fast.Append(tail) && fast.Size() == 1102 && fast[1101] == 2 && fast.Capacity() == 2048, "Vector::Append()");
+
+    std::cout << INFO << "VectorGrowth Test Passed" << std::endl << std::endl;
+}
+
+void TestCowVector(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning CowVector Test" << std::endl;
+
+    CowVector<i32> original;
+    for (i32 i = 0; i < 100; i++)
+        original.PushBack(i);
+    CowVector<i32> snapshot = original;
+    Check(snapshot.Data() == original.Data() && original.UseCount() == 2, "CowVector copy shares its buffer");
+
+    const CowVector<i32>& reader = snapshot;
+    Check(reader[50] == 50 && snapshot.UseCount() == 2, "CowVector const access does not clone");
+
+    snapshot[50] = -50;
+    Check(snapshot.Data() != original.Data() && original.Unique() && snapshot.Unique(), "CowVector write clones");
+    Check(original[50] == 50 && snapshot[50] == -50, "CowVector clone is independent");
+
+    CowVector<i32> other = original;
+    other.PushBack(100);
+    Check(original.Size() == 100 && other.Size() == 101 && other[100] == 100, "CowVector::PushBack() clones");
+    Check(! other.Remove(100) && other == original && other.Data() != original.Data(), "CowVector::Remove()");
+
+    other = original;
+    other.Erase();
+    Check(other.Empty() && original.Size() == 100 && original.Unique(), "CowVector::Erase() releases");
+
+    std::cout << INFO << "CowVector Test Passed" << std::endl << std::endl;
+}
+
+void TestSegmentedVector(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning SegmentedVector Test" << std::endl;
+
+    SegmentedVector<u64> vec;
+    vec.PushBack(0);
+    const u64* const first = &vec[0];
+    for (u64 i = 1; i < 1000; i++)
+        vec.PushBack(i);
+    Check(&vec[0] == first, "SegmentedVector growth never relocates");
+    Check(vec.Size() == 1000 && vec.Capacity() >= 1000, "SegmentedVector::Size()");
+
+    bool ordered = true;
+    for (u32 i = 0; i < vec.Size(); i++)
+        ordered = ordered && vec[i] == i;
+    Check(ordered, "SegmentedVector::operator []");
+
+    u64 sum = 0;
+    for (u32 k = 0; k < vec.SegmentCount(); k++)
+        for (u32 i = 0; i < vec.SegmentSize(k); i++)
+            sum += vec.Segment(k)[i];
+    Check(sum == 999 * 1000 / 2, "SegmentedVector segment iteration");
+
+    u64 back = 0;
+    Check(! vec.PopBack(back) && back == 999 && vec.Size() == 999, "SegmentedVector::PopBack()");
+    SegmentedVector<u64> copy = vec;
+    Check(copy.Size() == 999 && copy[998] == 998 && &copy[0] != first, "SegmentedVector copy");
+
+    vec.Erase();
+    Check(! vec.Shrink() && vec.Capacity() == 0, "SegmentedVector::Shrink()");
+
+    std::cout << INFO << "SegmentedVector Test Passed" << std::endl << std::endl;
+}
+
+void TestSoAVector(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning SoAVector Test" << std::endl;
+
+    SoAVector<u32, f32, u8> rows;
+    for (u32 i = 0; i < 100; i++)
+        rows.PushBack(i, (f32)(i) * 0.5f, (u8)(i % 3));
+    Check(rows.Size() == 100, "SoAVector::PushBack()");
+    Check((uSIZE)(rows.Column<1>()) % SoAVector<u32, f32, u8>::COLUMN_ALIGNMENT == 0, "SoAVector column alignment");
+
+    f32 sum = 0.0f;
+    const f32* const column = rows.Column<1>();
+    for (u32 i = 0; i < rows.Size(); i++)
+        sum += column[i];
+    Check(sum == 2475.0f, "SoAVector::Column()");
+
+    rows[7].Get<2>() = 9;
+    rows[8].Set(80, 8.0f, 8);
+    const SoAVector<u32, f32, u8>& view = rows;
+    Check(view[7].Get<2>() == 9 && view[8].Get<0>() == 80 && rows.At<1>(8) == 8.0f, "SoAVector row proxies");
+
+    Check(! rows.SwapRemove(0) && rows.At<0>(0) == 99 && rows.Size() == 99, "SoAVector::SwapRemove()");
+    SoAVector<u32, f32, u8> copy = rows;
+    Check(copy.Size() == 99 && copy.At<0>(8) == 80 && copy.Column<0>() != rows.Column<0>(), "SoAVector copy");
+
+    std::cout << INFO << "SoAVector Test Passed" << std::endl << std::endl;
+}
+
+void TestPersistentVector(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning PersistentVector Test" << std::endl;
+
+    PersistentVector<u32> empty;
+    PersistentVector<u32> one = empty.PushBack(7);
+    Check(empty.Empty() && one.Size() == 1 && one[0] == 7, "PersistentVector::PushBack() keeps old versions");
+
+    PersistentVector<u32>::Transient batch;
+    for (u32 i = 0; i < 5000; i++)
+        batch.PushBack(i);
+    const PersistentVector<u32> big = batch.ToPersistent();
+    Check(big.Size() == 5000 && big[4999] == 4999 && big.Height() == 3, "PersistentVector::Transient");
+    batch.Update(0, 42);
+    Check(big[0] == 0 && batch[0] == 42, "PersistentVector::Transient copies shared nodes");
+
+    const PersistentVector<u32> changed = big.Update(1234, 0);
+    Check(changed[1234] == 0 && big[1234] == 1234 && changed[1235] == 1235, "PersistentVector::Update()");
+    bool thrown = false;
+    try { big.Update(5000, 0); } catch (const InvalidIndex& err) { thrown = true; }
+    Check(thrown, "PersistentVector::Update() out of bounds");
+
+    const PersistentVector<u32> middle = big.Slice(1000, 3100);
+    Check(middle.Size() == 2100 && middle[0] == 1000 && middle[2099] == 3099, "PersistentVector::Slice()");
+
+    PersistentVector<u32> joined = middle.Concat(big.Slice(7, 40));
+    for (u32 i = 0; i < 20; i++)
+        joined = joined.Concat(middle.Slice(i, i + 33));
+    bool ordered = joined.Size() == 2133 + 20 * 33;
+    for (u32 i = 0; i < 20 && ordered; i++)
+        for (u32 j = 0; j < 33; j++)
+            ordered = ordered && joined[2133 + i * 33 + j] == 1000 + i + j;
+    Check(ordered && joined[2100] == 7 && joined.Height() <= 4, "PersistentVector::Concat()");
+    Check(joined.PushBack(1)[joined.Size()] == 1 && joined.PopBack().Size() == joined.Size() - 1,
+        "PersistentVector::PushBack() after Concat()");
+    Check(big.Slice(1000, 3100) == middle && big != middle, "PersistentVector::Equals()");
+
+    std::cout << INFO << "PersistentVector Test Passed" << std::endl << std::endl;
+}
+
+void TestConcurrentVector(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning ConcurrentVector Test" << std::endl;
+
+    ConcurrentVector<u64> results;
+    Check(! results.Reserve(100) && results.Capacity() >= 100 && results.Empty(), "ConcurrentVector::Reserve()");
+
+    const u32 writers = 4;
+    const u32 pushes  = 20000;
+    std::thread threads[writers];
+    for (u32 t = 0; t < writers; t++)
+        threads[t] = std::thread([&results, t](void)
+        {
+            for (u32 i = 0; i < pushes; i++)
+                results.PushBack(((u64)(t) << 32) | i);
+        });
+    for (u32 t = 0; t < writers; t++)
+        threads[t].join();
+    Check(results.Size() == writers * pushes && results.Reserved() == writers * pushes, "ConcurrentVector::PushBack()");
+
+    u64 sums[writers] = { 0 };
+    u32 next[writers] = { 0 };
+    bool ordered = true;
+    for (u32 i = 0; i < results.Size(); i++)
+    {
+        const u32 t = (u32)(results[i] >> 32);
+        ordered = ordered && (u32)(results[i]) == next[t]++;
+        sums[t] += (u32)(results[i]);
+    }
+    for (u32 t = 0; t < writers; t++)
+        ordered = ordered && sums[t] == (u64)(pushes) * (pushes - 1) / 2;
+    Check(ordered, "ConcurrentVector keeps every element & each writer's order");
+
+    u32 index = 0;
+    u64 value = 0;
+    Check(! results.PushBack(7, index) && index == writers * pushes && results.At(index) == 7, "ConcurrentVector index");
+    Check(results.TryGet(index + 1, value) && ! results.TryGet(index, value) && value == 7, "ConcurrentVector::TryGet()");
+    results.Erase();
+    Check(results.Size() == 0 && results.Capacity() == 0, "ConcurrentVector::Erase()");
+
+    std::cout << INFO << "ConcurrentVector Test Passed" << std::endl << std::endl;
+}
+
+void TestBitVector(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning BitVector Test" << std::endl;
+
+    BitVector multiples(10000);
+    for (u64 i = 0; i < multiples.Size(); i += 3)
+        multiples.Set(i);
+    Check(multiples.Size() == 10000 && multiples.Count() == 3334 && multiples[9999], "BitVector::Set()");
+    Check(multiples.FindFirst() == 0 && multiples.FindNext(0) == 3 && multiples.FindNext(9999) == -1,
+        "BitVector::FindFirst() & FindNext()");
+    Check(multiples.Set(10000) && multiples.Flip(10000), "BitVector bounds checking");
+
+    Check(! multiples.BuildIndex() && multiples.Indexed(), "BitVector::BuildIndex()");
+    Check(multiples.Rank(0) == 0 && multiples.Rank(4) == 2 && multiples.Rank(10000) == 3334, "BitVector::Rank()");
+    Check(multiples.Select(0) == 0 && multiples.Select(2000) == 6000 && multiples.Select(3334) == -1,
+        "BitVector::Select()");
+
+    BitVector evens(10000);
+    for (u64 i = 0; i < evens.Size(); i += 2)
+        evens.Set(i);
+    BitVector both = multiples;
+    Check(! both.And(evens) && both.Count() == 1667 && ! both.Indexed(), "BitVector::And()");
+    Check(! both.Or(evens) && both == evens && both.Xor(BitVector(3)), "BitVector::Or()");
+    both.Not();
+    Check(both.Count() == 5000 && both.FindFirst() == 1, "BitVector::Not()");
+
+    BitVector flags;
+    for (u32 i = 0; i < 130; i++)
+        flags.PushBack(i % 64 == 0);
+    bool last = true;
+    Check(flags.Count() == 3 && ! flags.PopBack(last) && ! last && flags.Size() == 129, "BitVector::PushBack()");
+    Check(! flags.Resize(200, true) && flags.Count() == 74 && flags.Select(3) == 129, "BitVector::Resize()");
+
+    std::cout << INFO << "BitVector Test Passed" << std::endl << std::endl;
+}
+
+void TestStaticBitset(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning StaticBitset Test" << std::endl;
+
+    constexpr StaticBitset<100> primes = []()
+    {
+        StaticBitset<100> sieve;
+        sieve.SetAll();
+        sieve.Reset(0);
+        sieve.Reset(1);
+        for (i64 i = sieve.FindFirst(); i >= 0 && i * i < 100; i = sieve.FindNext((u64)(i)))
+            for (u64 j = (u64)(i * i); j < 100; j += (u64)(i))
+                sieve.Reset(j);
+        return sieve;
+    }();
+    static_assert(primes.Count() == 25 && primes[97] && ! primes[91] && primes.FindFirst() == 2, "constexpr sieve");
+    static_assert(primes.FindNext(89) == 97 && primes.FindNext(97) == -1, "constexpr StaticBitset::FindNext()");
+    static_assert(sizeof(StaticBitset<8>) == 1 && sizeof(StaticBitset<20>) == 4 && sizeof(StaticBitset<65>) == 16,
+                  "StaticBitset uses the narrowest words");
+    static_assert(std::is_trivially_copyable<StaticBitset<100>>::value, "StaticBitset is trivially copyable");
+
+    StaticBitset<70> a;
+    StaticBitset<70> b(0b1010);
+    Check(! a.Set(3) && ! a.Set(64) && ! a.Set(69) && a.Set(70) && a.Test(64) && ! a.Test(70), "StaticBitset::Set()");
+    Check((a & b).Count() == 1 && (a | b).Count() == 4 && (a ^ b).Count() == 3, "StaticBitset word operators");
+    Check((~a).Count() == 67 && ! (~a)[69] && (~~a) == a, "StaticBitset::Not() keeps the tail clear");
+    a.AndNot(b);
+    Check(a.Count() == 2 && a.FindFirst() == 64, "StaticBitset::AndNot()");
+    a.SetAll();
+    Check(a.All() && a.Count() == 70 && ! a.Flip(0) && ! a.All(), "StaticBitset::SetAll() & Flip()");
+
+    u64 sum = 0;
+    u64 count = 0;
+    primes.ForEach([&sum, &count](const u64 index) { sum += index; count++; });
+    Check(sum == 1060 && count == 25, "StaticBitset::ForEach()");
+    a.ResetAll();
+    Check(a.None() && a.FindFirst() == -1 && StaticBitset<5>(0xFF).Count() == 5, "StaticBitset::ResetAll()");
+
+    std::cout << INFO << "StaticBitset Test Passed" << std::endl << std::endl;
+}
+
+void TestPackedIntVector(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning PackedIntVector Test" << std::endl;
+
+    PackedIntVector small;
+    PackedIntVector ids(PACKED_DELTA);
+    for (u64 i = 0; i < 1000; i++)
+    {
+        small.PushBack(1000000 + (i * 7919) % 200);
+        ids += 5000000000 + i * 3 + (i % 5 == 0);
+    }
+    Check(small.Size() == 1000 && small.BlockCount() == 8, "PackedIntVector::PushBack()");
+    Check(small.Footprint() < 1000 * sizeof(u64) / 3, "PackedIntVector frame of reference packs small values");
+    Check(ids.Footprint() < small.Footprint(), "PackedIntVector delta encoding packs monotonic values");
+
+    bool same = true;
+    for (u64 i = 0; i < 1000; i++)
+        same &= small[i] == 1000000 + (i * 7919) % 200 && ids.At(i) == 5000000000 + i * 3 + (i % 5 == 0);
+    Check(same, "PackedIntVector random access");
+
+    bool threw = false;
+    try
+    {
+        ids.At(1000);
+    }
+    catch (const InvalidIndex& err)
+    {
+        threw = true;
+    }
+    Check(threw, "PackedIntVector::At() out of bounds");
+
+    u64 block[PackedIntVector::BLOCK_LENGTH];
+    Check(ids.DecodeBlock(2, block) == 128 && block[0] == ids[256] && block[127] == ids[383], "PackedIntVector::DecodeBlock()");
+    Check(ids.DecodeBlock(7, block) == 1000 - 7 * 128 && ids.DecodeBlock(8, block) == 0, "PackedIntVector tail block");
+
+    u64 sum = 0;
+    u64 expected = 0;
+    small.ForEach([&sum](const u64 x) { sum += x; });
+    for (u64 i = 0; i < 1000; i++)
+        expected += small[i];
+    Check(sum == expected, "PackedIntVector::ForEach()");
+    u64 evens = 0;
+    for (u64 i = 200; i < 1000; i++)
+        evens += ids[i] % 2 == 0;
+    Check(ids.Stream().Skip(200).Filter([](const u64 x) { return x % 2 == 0; }).Count() == evens,
+        "PackedIntVector::Stream()");
+
+    PackedIntVector extremes;
+    for (u64 i = 0; i < 300; i++)
+        extremes.PushBack(i % 2 ? 0xFFFFFFFFFFFFFFFF : i);
+    Check(extremes[255] == 0xFFFFFFFFFFFFFFFF && extremes[256] == 256 && extremes[299] == 0xFFFFFFFFFFFFFFFF,
+        "PackedIntVector full width blocks");
+
+    std::cout << INFO << "PackedIntVector Test Passed" << std::endl << std::endl;
+}
+
+void TestDeque(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning Deque Test" << std::endl;
+
+    Deque<i32> deque;
+    Check(deque.Empty() && deque.Capacity() == 0, "Deque default construction");
+    for (i32 i = 0; i < 6; i++)
+    {
+        deque.PushBack(i);
+        deque.PushFront(-i - 1);
+    }
+    Check(deque.Size() == 12 && deque.Capacity() == 16, "Deque grows to a power of two");
+    Check(deque[0] == -6 && deque[5] == -1 && deque[6] == 0 && deque.PeekBack() == 5, "Deque order");
+
+    i32 x = 0;
+    Check(! deque.PopFront(x) && x == -6 && ! deque.PopBack(x) && x == 5 && deque.Size() == 10, "Deque::Pop()");
+
+    Deque<i32>::Span<const i32> first;
+    Deque<i32>::Span<const i32> second;
+    ((const Deque<i32>&)(deque)).Spans(first, second);
+    Check(first._Count + second._Count == 10 && second._Count > 0 && first._Data[0] == -5 &&
+          second._Data[second._Count - 1] == 4, "Deque::Spans() wrap around");
+
+    for (i32 i = 0; i < 100; i++)
+        deque.PushBack(100 + i);
+    Check(deque.Size() == 110 && deque.Capacity() == 128 && deque[0] == -5 && deque[109] == 199,
+        "Deque unwraps on growth");
+
+    i32 buffer[64];
+    Check(deque.PopFront(buffer, 64) == 64 && buffer[0] == -5 && buffer[5] == 0 && buffer[63] == 153, "Deque bulk pop");
+    const i32 batch[] = { 7, 8, 9 };
+    Check(! deque.PushBack(batch, 3) && deque.Size() == 49 && deque.PeekBack() == 9, "Deque bulk push");
+
+    Deque<i32> copy(deque);
+    Check(copy == deque && copy[0] == 154, "Deque copy");
+    copy.PopBack(x);
+    Check(copy != deque, "Deque::operator !=()");
+
+    bool threw = false;
+    try
+    {
+        deque.At(49);
+    }
+    catch (const InvalidIndex& err)
+    {
+        threw = true;
+    }
+    Check(threw, "Deque::At() out of bounds");
+
+    std::cout << INFO << "Deque Test Passed" << std::endl << std::endl;
+}
+
+void TestSpscQueue(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning SpscQueue Test" << std::endl;
+
+    SpscQueue<u64, 8> small;
+    u64 x = 0;
+    Check(small.TryPop(x) && ! small.TryPush(1) && ! small.TryPop(x) && x == 1, "SpscQueue::TryPush() & TryPop()");
+    const u64 batch[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    Check(small.TryPushN(batch, 10) == 8 && small.TryPush(11) && small.Count() == 8, "SpscQueue::TryPushN() when full");
+    u64 out[10] = { 0 };
+    Check(small.TryPopN(out, 3) == 3 && out[2] == 3 && small.TryPushN(batch, 10) == 3, "SpscQueue::TryPopN()");
+    Check(small.TryPopN(out, 10) == 8 && out[4] == 8 && out[5] == 1 && out[7] == 3 && small.Empty(), "SpscQueue wraps around");
+
+    SpscQueue<u64, 1024> pipe;
+    const u64 total = 200000;
+    std::thread producer([&pipe, total](void)
+    {
+        u64 chunk[32];
+        for (u64 next = 0; next < total; )
+        {
+            if (next % 3 == 0)
+            {
+                next += ! pipe.TryPush(next);
+                continue;
+            }
+            const u64 count = total - next < 32 ? total - next : 32;
+            for (u64 i = 0; i < count; i++)
+                chunk[i] = next + i;
+            next += pipe.TryPushN(chunk, count);
+        }
+    });
+    u64 expected = 0;
+    bool ordered = true;
+    u64 chunk[48];
+    while (expected < total)
+    {
+        const u64 popped = pipe.TryPopN(chunk, 48);
+        for (u64 i = 0; i < popped; i++)
+            ordered = ordered && chunk[i] == expected++;
+    }
+    producer.join();
+    Check(ordered && pipe.Empty(), "SpscQueue hands every element over in order");
+
+    std::cout << INFO << "SpscQueue Test Passed" << std::endl << std::endl;
+}
+
+void TestMpmcQueue(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning MpmcQueue Test" << std::endl;
+
+    MpmcQueue<u64> small(3);
+    u64 x = 0;
+    Check(small.Capacity() == 4 && small.TryPop(x), "MpmcQueue rounds its capacity up to a power of two");
+    for (u64 i = 0; i < 4; i++)
+        small.Push(i);
+    Check(small.TryPush(4) && small.Count() == 4, "MpmcQueue::TryPush() when full");
+    Check(! small.TryPop(x) && x == 0 && ! small.TryPush(4), "MpmcQueue::TryPop()");
+    bool ordered = true;
+    for (u64 i = 1; i < 5; i++)
+    {
+        small.Pop(x);
+        ordered = ordered && x == i;
+    }
+    Check(ordered && small.Empty(), "MpmcQueue is first in first out");
+
+    const u32 producers = 4;
+    const u32 consumers = 4;
+    const u64 pushes    = 50000;
+    MpmcQueue<u64> work(256);
+    std::thread threads[producers + consumers];
+    std::atomic<u64> sum(0);
+    std::atomic<u64> popped(0);
+    u64 last[consumers][producers];
+    bool monotonic[consumers];
+    for (u32 t = 0; t < producers; t++)
+        threads[t] = std::thread([&work, t](void)
+        {
+            for (u64 i = 1; i <= pushes; i++)
+                work.Push(((u64)(t) << 32) | i);
+        });
+    for (u32 c = 0; c < consumers; c++)
+        threads[producers + c] = std::thread([&, c](void)
+        {
+            u64 local = 0;
+            monotonic[c] = true;
+            for (u32 t = 0; t < producers; t++)
+                last[c][t] = 0;
+            for (u64 i = 0; i < producers * pushes / consumers; i++)
+            {
+                u64 value = 0;
+                work.Pop(value);
+                const u32 t = (u32)(value >> 32);
+                monotonic[c] = monotonic[c] && (value & 0xFFFFFFFF) > last[c][t];
+                last[c][t] = value & 0xFFFFFFFF;
+                local += value & 0xFFFFFFFF;
+            }
+            sum += local;
+            popped += producers * pushes / consumers;
+        });
+    for (u32 t = 0; t < producers + consumers; t++)
+        threads[t].join();
+    bool inOrder = true;
+    for (u32 c = 0; c < consumers; c++)
+        inOrder = inOrder && monotonic[c];
+    Check(popped == producers * pushes && sum == producers * (pushes * (pushes + 1) / 2) && work.Empty(),
+        "MpmcQueue hands every element over exactly once");
+    Check(inOrder, "MpmcQueue keeps each producer's order");
+
+    std::cout << INFO << "MpmcQueue Test Passed" << std::endl << std::endl;
+}
+
+void TestFlatMap(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning FlatMap Test" << std::endl;
+
+    const i32 keys[]   = { 5, 3, 9, 3, 1 };
+    const i32 values[] = { 50, 30, 90, 31, 10 };
+    FlatMap<i32, i32> map(keys, values, 5);
+    Check(map.Count() == 4, "FlatMap bulk construction dedupes");
+    Check(IsSorted(map.Keys(), map.Count()), "FlatMap keys are sorted");
+    Check(map.At(3) == 31, "FlatMap bulk construction keeps the last value");
+    Check(map.Find(4) == nullptr && map.IndexOf(4) == -1, "FlatMap::Find() on a missing key");
+
+    Check(! map.Insert(4, 40) && map.At(4) == 40, "FlatMap::Insert()");
+    Check(! map.Insert(4, 41) && map.At(4) == 41 && map.Count() == 5, "FlatMap::Insert() overwrites");
+    Check(! map.Remove(9) && map.Remove(9), "FlatMap::Remove()");
+
+    const i32 batchKeys[]   = { 7, 0, 5, 7 };
+    const i32 batchValues[] = { 70, 0, 55, 71 };
+    Check(! map.InsertBatch(batchKeys, batchValues, 4), "FlatMap::InsertBatch()");
+    Check(map.Count() == 6 && IsSorted(map.Keys(), map.Count()), "FlatMap::InsertBatch() merges");
+    Check(map.At(5) == 55 && map.At(7) == 71 && map.At(0) == 0, "FlatMap::InsertBatch() values");
+
+    FlatMap<i32, i32> grown;
+    bool ok = true;
+    for (i32 i = 100; i > 0; i--)
+        ok = ok && ! grown.Insert(i, 10 * i);
+    for (i32 i = 1; i <= 100; i++)
+        ok = ok && grown.At(i) == 10 * i;
+    Check(ok && grown.Count() == 100, "FlatMap::Insert() keeps keys & values in step as both grow");
+
+    std::cout << INFO << "FlatMap Test Passed" << std::endl << std::endl;
+}
+
+void TestFlatSet(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning FlatSet Test" << std::endl;
+
+    const u64 keys[] = { 8, 2, 8, 6, 4, 2 };
+    FlatSet<u64> set(keys, 6);
+    Check(set.Count() == 4 && set[0] == 2 && set[3] == 8, "FlatSet bulk construction");
+    Check(set.Contains(6) && ! set.Contains(5), "FlatSet::Contains()");
+    Check(! set.Insert(5) && set.Insert(5) && set.LowerBound(5) == 2, "FlatSet::Insert()");
+
+    const u64 batch[] = { 9, 1, 5 };
+    set.InsertBatch(batch, 3);
+    Check(set.Count() == 7 && IsSorted(set.Keys(), set.Count()), "FlatSet::InsertBatch()");
+    Check(! set.Remove(1) && set.IndexOf(1) == -1, "FlatSet::Remove()");
+
+    std::cout << INFO << "FlatSet Test Passed" << std::endl << std::endl;
+}
+
+void TestSlotMap(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning SlotMap Test" << std::endl;
+
+    SlotMap<i32> map;
+    const Index a = map.Insert(10);
+    const Index b = map.Insert(20);
+    const Index c = map.Insert(30);
+    Check(a.Valid() && b.Valid() && c.Valid() && map.Size() == 3, "SlotMap::Insert()");
+    Check(map.At(a) == 10 && map[b] == 20 && *map.Find(c) == 30, "SlotMap lookup");
+
+    Check(! map.Erase(a) && map.Erase(a) && ! map.Contains(a) && map.Find(a) == nullptr, "SlotMap::Erase()");
+    Check(map.Size() == 2 && map.Data()[0] == 30 && map.HandleAt(0) == c && map[c] == 30, "SlotMap stays dense");
+
+    const Index d = map.Insert(40);
+    Check((u32)(d.Value()) == (u32)(a.Value()) && d != a, "SlotMap reuses slots with a new generation");
+    Check(! map.Contains(a) && map[d] == 40, "SlotMap detects stale handles");
+
+    bool threw = false;
+    try
+    {
+        map.At(a);
+    }
+    catch (const InvalidIndex& err)
+    {
+        threw = true;
+    }
+    Check(threw && ! map.Contains(Index { -1 }) && ! map.HandleAt(3).Valid(), "SlotMap invalid handles");
+
+    i32 sum = 0;
+    for (u32 i = 0; i < map.Size(); i++)
+        sum += map.Data()[i];
+    Check(sum == 90, "SlotMap dense iteration");
+
+    map.Erase();
+    Check(map.Empty() && ! map.Contains(b) && ! map.Contains(c) && ! map.Contains(d), "SlotMap::Erase() all");
+    const Index e = map.Insert(50);
+    Check(map.Size() == 1 && map[e] == 50 && ! map.Contains(d), "SlotMap reuse after Erase() all");
+
+    std::cout << INFO << "SlotMap Test Passed" << std::endl << std::endl;
+}
+
+class CollidingHash
+{
+public:
+    alt::u64 operator () (const alt::u32& x) const noexcept { return x & 3; }
+};
+
+void TestStaticHashMap(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning StaticHashMap Test" << std::endl;
+
+    StaticHashMap<u64, i32, 16> map;
+    for (i32 i = 0; i < 16; i++)
+        Check(! map.Insert((u64)(i) * 1000, i), "StaticHashMap::Insert()");
+    Check(map.Full() && map.Insert(7, 7) && ! map.Contains(7), "StaticHashMap rejects new keys when full");
+    Check(! map.Insert(3000, -3) && map.At(3000) == -3 && map.Count() == 16, "StaticHashMap::Insert() overwrites");
+    Check(map.Find(3001) == nullptr && ! map.Contains(1), "StaticHashMap::Find() on a missing key");
+    i32 value = 0;
+    Check(! map.Remove(5000, value) && value == 5 && map.Remove(5000), "StaticHashMap::Remove()");
+    i64 sum = 0;
+    map.ForEach([&sum](const u64&, const i32& value) { sum += value; });
+    Check(map.Count() == 15 && sum == 120 - 5 - 6, "StaticHashMap::ForEach()");
+
+    // every key shares one of four home slots, so removals must shift whole probe runs back
+    StaticHashMap<u32, u32, 32, CollidingHash> crowded;
+    for (u32 i = 0; i < 24; i++)
+        crowded.Insert(i, i * i);
+    for (u32 i = 0; i < 24; i += 3)
+        crowded.Remove(i);
+    bool ok = crowded.Count() == 16;
+    for (u32 i = 0; i < 24; i++)
+        ok = ok && (i % 3 == 0 ? ! crowded.Contains(i) : crowded.At(i) == i * i);
+    Check(ok, "StaticHashMap backward shift deletion");
+    crowded.Erase();
+    Check(crowded.Empty() && ! crowded.Contains(1), "StaticHashMap::Erase()");
+
+    std::cout << INFO << "StaticHashMap Test Passed" << std::endl << std::endl;
+}
+
+void TestEytzingerIndex(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning EytzingerIndex Test" << std::endl;
+
+    Vector<i32> sorted(1000);
+    for (i32 i = 0; i < 1000; i++)
+        sorted.PushBack(3 * (i / 2));   // every key appears twice
+    EytzingerIndex<i32> index(sorted);
+    bool ok = index.Count() == 1000;
+    for (i32 key = -2; key < 1502; key++)
+        ok = ok && index.LowerBound(key) == LowerBound(sorted.Data(), sorted.Size(), key);
+    Check(ok, "EytzingerIndex::LowerBound() matches alt::LowerBound()");
+    Check(index.IndexOf(6) == 4 && index.IndexOf(7) == -1 && index.Contains(1497) && ! index.Contains(1500),
+          "EytzingerIndex::IndexOf() & Contains()");
+    Check(*index.Find(8) == 9 && index.Find(1498) == nullptr, "EytzingerIndex::Find()");
+
+    Array<u64, 7> small;
+    Array<u64, 7> reversed;
+    for (u64 key : {2, 3, 5, 7, 11, 13, 17})
+    {
+        small.Enqueue(key);
+        reversed.Push(key);
+    }
+    EytzingerIndex<u64, Greater<u64>> descending(reversed, Greater<u64> {});
+    Check(descending.LowerBound(12) == 2 && descending.LowerBound(1) == 7, "EytzingerIndex with a comparator");
+    EytzingerIndex<u64> moved((EytzingerIndex<u64>&&)(EytzingerIndex<u64>(small)));
+    EytzingerIndex<u64> empty;
+    Check(moved.LowerBound(6) == 3 && empty.Empty() && empty.LowerBound(6) == 0, "EytzingerIndex move & empty");
+
+    std::cout << INFO << "EytzingerIndex Test Passed" << std::endl << std::endl;
+}
+
+void TestView(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning View Test" << std::endl;
+
+    Vector<i32> numbers;
+    for (i32 i = 0; i < 100; i++)
+        numbers.PushBack(i);
+
+    Vector<i32> squares;
+    Check(! View(numbers).Filter([](const i32 x) { return x % 2 == 1; })
+                         .Map([](const i32 x) { return x * x; })
+                         .Skip(1)
+                         .Take(3)
+                         .CollectInto(squares), "View::CollectInto()");
+    Check(squares.Size() == 3 && squares[0] == 9 && squares[1] == 25 && squares[2] == 49, "View fused pipeline");
+
+    u32 calls = 0;
+    auto counted = View(numbers).Map([&calls](const i32 x) { calls++; return (f64)(x) / 2.0; });
+    Check(calls == 0, "View adaptors are lazy");
+    Vector<f64> halves;
+    Check(! counted.Skip(90).CollectInto(halves) && halves.Size() == 10 && halves.Capacity() == 10 && calls == 10,
+        "View::CollectInto() presizes & Skip() doesn't evaluate");
+
+    Array<i32, 4> weights;
+    weights += 10;
+    weights += 20;
+    weights += 30;
+    const i32 dot = View(numbers).Zip(View(weights)).Fold(0, [](const i32 sum, const Pair<i32, i32>& pair)
+    {
+        return sum + pair._First * pair._Second;
+    });
+    Check(dot == 0 * 10 + 1 * 20 + 2 * 30 && View(numbers).Zip(View(weights)).Count() == 3, "View::Zip()");
+
+    u64 matches = 0;
+    View(numbers).Skip(5).Enumerate().ForEach([&matches](const Pair<u64, i32>& pair)
+    {
+        matches += (pair._Second == (i32)(pair._First) + 5);
+    });
+    Check(matches == 95 && View(numbers).Filter([](const i32 x) { return x < 10; }).Count() == 10, "View::Enumerate()");
+
+    std::cout << INFO << "View Test Passed" << std::endl << std::endl;
+}
+
+/// NOTE: seek the scratch file back to its start & cut it to 'size' bytes, both return true on error
+bool SerialRewind(const alt::i32 file)
+{
+#ifdef _MSC_VER
+    return ::_lseeki64(file, 0, SEEK_SET) != 0;
+#else
+    return ::lseek(file, 0, SEEK_SET) != 0;
+#endif // _MSC_VER
+}
+
+bool SerialResize(const alt::i32 file, const alt::i64 size)
+{
+#ifdef _MSC_VER
+    return ::_chsize_s(file, size) != 0;
+#else
+    return ::ftruncate(file, (off_t)(size)) != 0;
+#endif // _MSC_VER
+}
+
+/// NOTE: not trivially copyable, so it needs the alt::Serializer specialization below, which packs its fields
+class SerialSample
+{
+public:
+    alt::i32 _Value;
+    alt::u8  _Flags;
+
+    SerialSample(const alt::i32 value = 0, const alt::u8 flags = 0) noexcept: _Value(value), _Flags(flags) {}
+    SerialSample(const SerialSample& copy) noexcept: _Value(copy._Value), _Flags(copy._Flags) {}
+    SerialSample& operator = (const SerialSample& copy) noexcept = default;
+};
+
+template <>
+class alt::Serializer<SerialSample>
+{
+public:
+
+    READONLY bool Raw = false;
+
+    static bool Save(alt::SerialWriter& out, const SerialSample& x) noexcept
+    {
+        return out.Write(x._Value) || out.Write(x._Flags);
+    }
+
+    static bool Load(alt::SerialReader& in, SerialSample& x) noexcept
+    {
+        return in.Read(x._Value) || in.Read(x._Flags);
+    }
+};
+
+void TestSerialize(void)
+{
+    using namespace alt;
+    std::cout << INFO << "Beginning Serialize Test" << std::endl;
+
+    FILE* const scratch = std::tmpfile();
+    Check(scratch != nullptr, "Serialize scratch file");
+    const i32 file = fileno(scratch);
+
+    Vector<i64> numbers;
+    for (i64 i = 0; i < 100000; i++)
+        numbers.PushBack(i * i - 7);
+    Vector<i64> loaded;
+    loaded.PushBack(42);
+    Check(! Save(file, numbers) && ! SerialRewind(file) && ! Load(file, loaded), "Serialize raw Vector");
+    Check(loaded.Size() == numbers.Size() && loaded.Equals(numbers), "Serialize raw Vector round trip");
+
+    Vector<i32> narrow;
+    SerialRewind(file);
+    Check(Load(file, narrow) && narrow.Empty(), "Serialize rejects a mismatched element size");
+    Check(! SerialResize(file, 1000) && ! SerialRewind(file) && Load(file, loaded),
+        "Serialize rejects a truncated payload");
+
+    Array<f64, 8> weights;
+    weights += 0.5;
+    weights += -2.25;
+    Array<f64, 8> loadedWeights;
+    SerialRewind(file);
+    Check(! Save(file, weights) && ! SerialRewind(file) && ! Load(file, loadedWeights) &&
+          loadedWeights == weights, "Serialize Array round trip");
+    Array<f64, 1> tooSmall;
+    Check(! SerialRewind(file) && Load(file, tooSmall), "Serialize rejects an Array without room");
+
+    Vector<u128> wide;
+    wide.PushBack(u128 { 1, 2 });
+    wide.PushBack(u128 { 0xFFFFFFFFFFFFFFFF, 0 });
+    Vector<u128> loadedWide;
+    Check(! SerialResize(file, 0) && ! SerialRewind(file) && ! Save(file, wide) &&
+          ! SerialRewind(file) && ! Load(file, loadedWide) && loadedWide.Size() == 2 &&
+          loadedWide[0] == wide[0] && loadedWide[1] == wide[1], "Serialize u128 round trip");
+
+    Vector<SerialSample> samples;
+    for (i32 i = 0; i < 5000; i++)
+        samples.PushBack(SerialSample { i, (u8)(i % 3) });
+    Vector<SerialSample> loadedSamples;
+    Check(! SerialResize(file, 0) && ! SerialRewind(file) && ! Save(file, samples) &&
+          ! SerialRewind(file) && ! Load(file, loadedSamples), "Serialize per-element hooks");
+    Check(loadedSamples.Size() == 5000 && loadedSamples[4999]._Value == 4999 && loadedSamples[4999]._Flags == 1 &&
+          loadedSamples[17]._Value == 17 && loadedSamples[17]._Flags == 2, "Serialize per-element round trip");
+
+    // a checkpoint of several records back to back, each Load() must stop exactly at the end of its own record
+    Vector<SerialSample> few;
+    for (i32 i = 0; i < 10; i++)
+        few.PushBack(SerialSample { -i, (u8)(i) });
+    Vector<i32> counts;
+    for (i32 i = 0; i < 7; i++)
+        counts.PushBack(i * 11);
+    Check(! SerialResize(file, 0) && ! SerialRewind(file) && ! Save(file, few) && ! Save(file, samples) &&
+          ! Save(file, counts) && ! Save(file, weights) && ! Save(file, few), "Serialize several records");
+    Vector<SerialSample> first;
+    Vector<SerialSample> second;
+    Vector<SerialSample> last;
+    Vector<i32> loadedCounts;
+    Array<f64, 8> moreWeights;
+    Check(! SerialRewind(file) && ! Load(file, first) && ! Load(file, second) && ! Load(file, loadedCounts) &&
+          ! Load(file, moreWeights) && ! Load(file, last), "Serialize loads several records in order");
+    Check(first.Size() == 10 && first[9]._Value == -9 && second.Size() == 5000 && second[4999]._Flags == 1 &&
+          loadedCounts.Equals(counts) && moreWeights == weights && last.Size() == 10 && last[3]._Flags == 3,
+          "Serialize several records round trip");
+    Check(Load(file, last), "Serialize stops at the end of the file");
+
+    std::fclose(scratch);
+    std::cout << INFO << "Serialize Test Passed" << std::endl << std::endl;
+}
+
 void TestUniquePointer(void)
 {
     using namespace alt;
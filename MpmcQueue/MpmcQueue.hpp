@@ -0,0 +1,258 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef MPMCQUEUE_HPP
+#define MPMCQUEUE_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Allocator.hpp"
+#include "Bits.hpp"
+
+#include <atomic> // exclusively for std::atomic
+#include <thread> // exclusively for std::this_thread::yield()
+
+namespace alt // MpmcQueue belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: MpmcQueue is a bounded queue any number of producer & consumer threads may use at once without a lock.
+/// Every cell carries a sequence number which says whose turn it is: a cell at position p is free for the producer
+/// claiming p while its sequence is p, & holds an element for the consumer claiming p while its sequence is p + 1.
+/// Producers & consumers each claim positions with a compare-and-swap on their own counter, so the two sides only
+/// meet on the cells themselves.
+///
+/// NOTE: each cell is padded to its own cache line so that neighbouring producers & consumers don't false share, &
+/// the two counters sit on separate lines too.
+///
+/// NOTE: TryPush() & TryPop() fail instead of waiting, Push() & Pop() spin briefly & then yield until they succeed.
+template <typename Datatype>
+class MpmcQueue
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+public:
+
+READONLY u64 CACHE_LINE       = 64;
+READONLY u64 MINIMUM_CAPACITY = 2;
+READONLY u64 MAXIMUM_CAPACITY = (u64)(1) << 31;
+READONLY u32 SPINS            = 64;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CELL
+private:
+
+class alignas(CACHE_LINE) _Cell
+{
+public:
+	std::atomic<u64> _Sequence;
+	Datatype         _Value;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	alignas(CACHE_LINE) std::atomic<u64> _Tail;      // The next position a producer claims
+	alignas(CACHE_LINE) std::atomic<u64> _Head;      // The next position a consumer claims
+	alignas(CACHE_LINE) _Cell*           _Cells;
+	u64                                  _Mask;
+	Allocator<_Cell>                     _Allocator;
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONSTRUCTOR & DESTRUCTOR
+public:
+
+/// NOTE: rounds 'capacity' up to a power of two between MINIMUM_CAPACITY & MAXIMUM_CAPACITY
+/// WARN: throws alt::MallocFailure if the cells can't be allocated
+explicit MpmcQueue(const u64 capacity):
+	_Tail(0),
+	_Head(0),
+	_Cells(nullptr),
+	_Mask(0),
+	_Allocator()
+{
+	const u64 clamped = capacity < MINIMUM_CAPACITY ? MINIMUM_CAPACITY :
+	                    capacity > MAXIMUM_CAPACITY ? MAXIMUM_CAPACITY : capacity;
+	const u64 length  = alt::NextPowerOfTwo(clamped);
+	_Cells = _Allocator.Allocate((u32)(length));
+	_Mask  = length - 1;
+	for (u64 i = 0; i < length; i++)
+		_Cells[i]._Sequence.store(i, std::memory_order_relaxed);
+}
+
+~MpmcQueue() noexcept
+{
+	_Allocator.Deallocate(_Cells);
+}
+
+MpmcQueue(const MpmcQueue& copy) = delete;
+MpmcQueue& operator = (const MpmcQueue& copy) = delete;
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+u64 Capacity(void) const noexcept
+{
+	return _Mask + 1;
+}
+
+/// NOTE: a snapshot, which other threads may have changed by the time it returns
+u64 Count(void) const noexcept
+{
+	const u64 head = _Head.load(std::memory_order_acquire);
+	const u64 tail = _Tail.load(std::memory_order_acquire);
+	return tail > head ? tail - head : 0;
+}
+
+bool Empty(void) const noexcept
+{
+	return Count() == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// NON-BLOCKING METHODS
+public:
+
+/// NOTE: returns true if the queue is full
+bool TryPush(const Datatype& x) noexcept
+{
+	_Cell* const cell = _ClaimPush();
+	if (! cell)
+		return true;
+	cell->_Value = x;
+	_Publish(cell);
+	return false;
+}
+
+/// NOTE: returns true if the queue is full, in which case 'x' is not moved from
+bool TryPush(Datatype&& x) noexcept
+{
+	_Cell* const cell = _ClaimPush();
+	if (! cell)
+		return true;
+	cell->_Value = (Datatype&&)(x);
+	_Publish(cell);
+	return false;
+}
+
+/// NOTE: returns true if the queue is empty
+bool TryPop(Datatype& rtn) noexcept
+{
+	u64 position = 0;
+	_Cell* const cell = _ClaimPop(position);
+	if (! cell)
+		return true;
+	rtn = (Datatype&&)(cell->_Value);
+	cell->_Sequence.store(position + Capacity(), std::memory_order_release);
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// BLOCKING METHODS
+public:
+
+/// NOTE: waits until there is room
+void Push(const Datatype& x) noexcept
+{
+	for (u32 attempt = 0; TryPush(x); attempt++)
+		_Backoff(attempt);
+}
+
+void Push(Datatype&& x) noexcept
+{
+	for (u32 attempt = 0; TryPush((Datatype&&)(x)); attempt++)
+		_Backoff(attempt);
+}
+
+/// NOTE: waits until there is an element
+void Pop(Datatype& rtn) noexcept
+{
+	for (u32 attempt = 0; TryPop(rtn); attempt++)
+		_Backoff(attempt);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEQUENCE HELPER METHODS
+private:
+
+/// NOTE: claims the next free position for a producer, returns nullptr if the queue is full
+_Cell* _ClaimPush(void) noexcept
+{
+	u64 position = _Tail.load(std::memory_order_relaxed);
+	while (true)
+	{
+		_Cell* const cell = _Cells + (position & _Mask);
+		const i64 lag = (i64)(cell->_Sequence.load(std::memory_order_acquire) - position);
+		if (lag == 0)
+		{
+			if (_Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				return cell;
+		}
+		else if (lag < 0)
+			return nullptr;
+		else
+			position = _Tail.load(std::memory_order_relaxed);
+	}
+}
+
+/// NOTE: hands a filled cell to the consumer which will claim its position
+void _Publish(_Cell* const cell) noexcept
+{
+	cell->_Sequence.store(cell->_Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/// NOTE: claims the next filled position for a consumer, returns nullptr if the queue is empty
+_Cell* _ClaimPop(u64& position) noexcept
+{
+	position = _Head.load(std::memory_order_relaxed);
+	while (true)
+	{
+		_Cell* const cell = _Cells + (position & _Mask);
+		const i64 lag = (i64)(cell->_Sequence.load(std::memory_order_acquire) - (position + 1));
+		if (lag == 0)
+		{
+			if (_Head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				return cell;
+		}
+		else if (lag < 0)
+			return nullptr;
+		else
+			position = _Head.load(std::memory_order_relaxed);
+	}
+}
+
+static void _Backoff(const u32 attempt) noexcept
+{
+	if (attempt >= SPINS)
+		std::this_thread::yield();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end MPMCQUEUE_HPP
@@ -0,0 +1,448 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef PACKEDINTVECTOR_HPP
+#define PACKEDINTVECTOR_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Bits.hpp"
+#include "Vector.hpp"
+#include "View.hpp"
+
+#include <utility> // exclusively for std::integer_sequence
+
+namespace alt // PackedIntVector belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum PackedEncoding
+{
+	PACKED_FRAME_OF_REFERENCE = 0,  // each value is stored as its distance from the smallest value of its block
+	PACKED_DELTA              = 1   // each value is stored as its distance from the previous value, less the block's
+	                                // smallest such distance
+}; // end enum PackedEncoding
+
+class PackedIntView;
+
+/// NOTE: PackedIntVector stores u64 values in blocks of BLOCK_LENGTH, each bit-packed at the width of its largest
+/// encoded value, so a block of small or slowly increasing values takes a fraction of the 8 bytes per value of a
+/// Vector<u64>.  A block of width w takes exactly 2w words, so blocks never share words & decoding never reads past
+/// the end of its block.  Values are appended into an unpacked tail block which is packed once it's full.
+///
+/// NOTE: frame of reference blocks are random access in O(1).  Delta blocks compress monotonic sequences far better,
+/// & keep the decoded value of every CHECKPOINT_INTERVAL'th slot beside the packed words, so a random access only sums
+/// the deltas after the checkpoint in front of it, which is at most CHECKPOINT_INTERVAL - 1 adds.  DecodeBlock() &
+/// Stream() decode a whole block at a time either way.  Deltas are taken modulo 2^64, so a delta block
+/// still round-trips values which decrease, it just packs them at full width.
+///
+/// NOTE: a block is decoded by an unpack kernel specialized for its width at compile time, which the compiler fully
+/// unrolls into straight-line shifts & masks with no per-value branches, & the base is added in a separate pass it can
+/// vectorize.
+class PackedIntVector
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+public:
+
+READONLY u32 BLOCK_LENGTH        = 128;
+READONLY u32 WORD_BITS           = 64;
+READONLY u32 CHECKPOINT_INTERVAL = 16;
+READONLY u32 BLOCK_CHECKPOINTS   = BLOCK_LENGTH / CHECKPOINT_INTERVAL - 1; // Slot 0 needs none, it's the block's _Base
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// BLOCK HEADER
+private:
+
+class _Block
+{
+public:
+	u64 _Base;      // The smallest value (frame of reference) or the first value (delta)
+	u64 _Step;      // The smallest delta (delta), unused by frame of reference
+	u32 _Offset;    // The index of the block's first word in _Words
+	u32 _Bits;      // The width of each packed value
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	PackedEncoding _Encoding;
+	u64            _Count;                  // The number of values, packed & in the tail
+	Vector<u64>    _Words;                  // The packed blocks, back to back
+	Vector<_Block> _Blocks;                 // The header of each packed block
+	Vector<u64>    _Checkpoints;            // BLOCK_CHECKPOINTS decoded values per delta block, back to back
+	u32            _TailCount;              // The number of values in the unpacked tail
+	u64            _Tail[BLOCK_LENGTH];     // The values which don't fill a block yet
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONSTRUCTORS
+public:
+
+explicit PackedIntVector(const PackedEncoding encoding = PACKED_FRAME_OF_REFERENCE) noexcept:
+	_Encoding(encoding),
+	_Count(0),
+	_Words(),
+	_Blocks(),
+	_Checkpoints(),
+	_TailCount(0),
+	_Tail{0}
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE ACCESSORS
+public:
+
+PackedEncoding Encoding(void) const noexcept
+{
+	return _Encoding;
+}
+
+u64 Size(void) const noexcept
+{
+	return _Count;
+}
+
+bool Empty(void) const noexcept
+{
+	return _Count == 0;
+}
+
+/// NOTE: the number of blocks, counting the tail if it holds any values
+u64 BlockCount(void) const noexcept
+{
+	return _Blocks.Size() + (_TailCount ? 1 : 0);
+}
+
+/// NOTE: the bytes the values occupy, packed blocks, block headers, checkpoints, & the tail included
+u64 Footprint(void) const noexcept
+{
+	return _Words.Size() * sizeof(u64) + _Blocks.Size() * sizeof(_Block) + _Checkpoints.Size() * sizeof(u64) +
+	       sizeof(_Tail);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+u64 At(const u64 index) const
+{
+	if (index >= _Count)
+		throw alt::InvalidIndex();
+	return this->operator [] (index);
+}
+
+u64 operator [] (const u64 index) const noexcept
+{
+	const u64 block = index / BLOCK_LENGTH;
+	const u32 slot  = (u32)(index % BLOCK_LENGTH);
+	if (block == _Blocks.Size())
+		return _Tail[slot];
+	const _Block& header = _Blocks[(u32)(block)];
+	const u64* const words = _Words.Data() + header._Offset;
+	if (_Encoding == PACKED_FRAME_OF_REFERENCE)
+		return header._Base + _Extract(words, header._Bits, slot);
+	const u32 checkpoint = slot / CHECKPOINT_INTERVAL;
+	const u32 first      = checkpoint * CHECKPOINT_INTERVAL;
+	u64 rtn = checkpoint ? _Checkpoints[(u32)(block) * BLOCK_CHECKPOINTS + checkpoint - 1] : header._Base;
+	rtn += (slot - first) * header._Step;
+	for (u32 i = first + 1; i <= slot; i++)
+		rtn += _Extract(words, header._Bits, i);
+	return rtn;
+}
+
+/// NOTE: decodes every value of 'block' into 'out', which must hold BLOCK_LENGTH values
+/// RTRN: the number of values decoded, zero if 'block' is out of bounds
+u32 DecodeBlock(const u64 block, u64* const out) const noexcept
+{
+	if (block < _Blocks.Size())
+	{
+		const _Block& header = _Blocks[(u32)(block)];
+		_Unpacker(header._Bits)(_Words.Data() + header._Offset, out);
+		if (_Encoding == PACKED_FRAME_OF_REFERENCE)
+			for (u32 i = 0; i < BLOCK_LENGTH; i++)
+				out[i] += header._Base;
+		else
+		{
+			out[0] = header._Base;
+			for (u32 i = 1; i < BLOCK_LENGTH; i++)
+				out[i] += out[i - 1] + header._Step;
+		}
+		return BLOCK_LENGTH;
+	}
+	if (block == _Blocks.Size())
+	{
+		for (u32 i = 0; i < _TailCount; i++)
+			out[i] = _Tail[i];
+		return _TailCount;
+	}
+	return 0;
+}
+
+/// NOTE: a lazy alt::View over the values which decodes a block at a time
+PackedIntView Stream(void) const noexcept;
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: returns true if the packed words or block headers could not grow, in which case nothing changes
+bool PushBack(const u64 x)
+{
+	_Tail[_TailCount] = x;
+	if (_TailCount + 1 == BLOCK_LENGTH)
+	{
+		if (_Pack())
+			return true;
+		_TailCount = 0;
+	}
+	else
+		_TailCount++;
+	_Count++;
+	return false;
+}
+
+bool operator += (const u64 x)
+{
+	return PushBack(x);
+}
+
+void Erase(void) noexcept
+{
+	_Words.Erase();
+	_Blocks.Erase();
+	_Checkpoints.Erase();
+	_Count     = 0;
+	_TailCount = 0;
+}
+
+template <typename Function>
+void ForEach(Function function) const
+{
+	u64 values[BLOCK_LENGTH];
+	for (u64 block = 0; block < BlockCount(); block++)
+	{
+		const u32 count = DecodeBlock(block, values);
+		for (u32 i = 0; i < count; i++)
+			function(values[i]);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// PACKING HELPER METHODS
+private:
+
+static u32 _Width(const u64 x) noexcept
+{
+	return WORD_BITS - alt::CountLeadingZeros(x);
+}
+
+static u64 _Extract(const u64* const words, const u32 bits, const u32 slot) noexcept
+{
+	if (! bits)
+		return 0;
+	const u32 bit   = slot * bits;
+	const u32 word  = bit / WORD_BITS;
+	const u32 shift = bit % WORD_BITS;
+	u64 rtn = words[word] >> shift;
+	if (shift + bits > WORD_BITS)
+		rtn |= words[word + 1] << (WORD_BITS - shift);
+	return bits == WORD_BITS ? rtn : rtn & (((u64)(1) << bits) - 1);
+}
+
+/// NOTE: encodes the full tail as a new block, returns true if the words, headers, or checkpoints could not grow
+bool _Pack(void)
+{
+	u64 encoded[BLOCK_LENGTH];
+	_Block header { 0, 0, _Words.Size(), 0 };
+	if (_Encoding == PACKED_FRAME_OF_REFERENCE)
+	{
+		u64 lowest = _Tail[0];
+		for (u32 i = 1; i < BLOCK_LENGTH; i++)
+			lowest = _Tail[i] < lowest ? _Tail[i] : lowest;
+		header._Base = lowest;
+		for (u32 i = 0; i < BLOCK_LENGTH; i++)
+			encoded[i] = _Tail[i] - lowest;
+	}
+	else
+	{
+		u64 step = _Tail[1] - _Tail[0];
+		for (u32 i = 2; i < BLOCK_LENGTH; i++)
+			step = _Tail[i] - _Tail[i - 1] < step ? _Tail[i] - _Tail[i - 1] : step;
+		header._Base = _Tail[0];
+		header._Step = step;
+		encoded[0] = 0;
+		for (u32 i = 1; i < BLOCK_LENGTH; i++)
+			encoded[i] = _Tail[i] - _Tail[i - 1] - step;
+	}
+	u64 all = 0;
+	for (u32 i = 0; i < BLOCK_LENGTH; i++)
+		all |= encoded[i];
+	header._Bits = _Width(all);
+
+	const u32 words       = 2 * header._Bits;
+	const u32 checkpoints = _Encoding == PACKED_DELTA ? BLOCK_CHECKPOINTS : 0;
+	if (_Reserve(_Words, (u64)(_Words.Size()) + words) ||
+		_Reserve(_Blocks, (u64)(_Blocks.Size()) + 1) ||
+		_Reserve(_Checkpoints, (u64)(_Checkpoints.Size()) + checkpoints))
+		return true;
+	u64 packed[2 * WORD_BITS] = { 0 };
+	for (u32 i = 0; header._Bits && i < BLOCK_LENGTH; i++)
+	{
+		const u32 bit   = i * header._Bits;
+		const u32 word  = bit / WORD_BITS;
+		const u32 shift = bit % WORD_BITS;
+		packed[word] |= encoded[i] << shift;
+		if (shift + header._Bits > WORD_BITS)
+			packed[word + 1] |= encoded[i] >> (WORD_BITS - shift);
+	}
+	// every Vector has room, so none of the PushBacks can fail
+	for (u32 i = 0; i < words; i++)
+		_Words.PushBack(packed[i]);
+	for (u32 i = 1; i <= checkpoints; i++)
+		_Checkpoints.PushBack(_Tail[i * CHECKPOINT_INTERVAL]);
+	_Blocks.PushBack(header);
+	return false;
+}
+
+/// NOTE: grows 'vector' by its growth policy until it can hold 'required' elements, returns true if it can't
+template <typename Datatype>
+static bool _Reserve(Vector<Datatype>& vector, const u64 required)
+{
+	if (required > GROWTH_MAXIMUM_CAPACITY)
+		return true;
+	if (required <= vector.Capacity())
+		return false;
+	return vector.Grow(vector.GrowthPolicy().Next(vector.Capacity(), (u32)(required), sizeof(Datatype)));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// UNPACKING HELPER METHODS
+private:
+
+using _UnpackKernel = void (*)(const u64* in, u64* out);
+
+/// NOTE: unpacks a block of width 'Width' without adding its base
+template <u32 Width>
+static void _Unpack(const u64* const in, u64* const out) noexcept
+{
+	if constexpr (Width == 0)
+	{
+		for (u32 i = 0; i < BLOCK_LENGTH; i++)
+			out[i] = 0;
+	}
+	else if constexpr (Width == WORD_BITS)
+	{
+		for (u32 i = 0; i < BLOCK_LENGTH; i++)
+			out[i] = in[i];
+	}
+	else
+	{
+		constexpr u64 mask = ((u64)(1) << Width) - 1;
+		for (u32 i = 0; i < BLOCK_LENGTH; i++)
+		{
+			const u32 bit   = i * Width;
+			const u32 shift = bit % WORD_BITS;
+			u64 x = in[bit / WORD_BITS] >> shift;
+			if (shift + Width > WORD_BITS)
+				x |= in[bit / WORD_BITS + 1] << (WORD_BITS - shift);
+			out[i] = x & mask;
+		}
+	}
+}
+
+template <u32... Widths>
+static _UnpackKernel _Dispatch(const u32 bits, std::integer_sequence<u32, Widths...>) noexcept
+{
+	static constexpr _UnpackKernel kernels[] = { &_Unpack<Widths>... };
+	return kernels[bits];
+}
+
+static _UnpackKernel _Unpacker(const u32 bits) noexcept
+{
+	return _Dispatch(bits, std::make_integer_sequence<u32, WORD_BITS + 1>{});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: the alt::View returned by PackedIntVector::Stream(), which borrows the PackedIntVector
+class PackedIntView final:
+	public ViewAdaptors<PackedIntView, u64>
+{
+public:
+
+	using Value = u64;
+
+private:
+
+	const PackedIntVector* _Vector;
+	u64                    _Next;
+	u64                    _Decoded;    // The index one past the last decoded value, _Buffer ends there
+	u64                    _Buffer[PackedIntVector::BLOCK_LENGTH];
+
+public:
+
+explicit PackedIntView(const PackedIntVector& vector) noexcept:
+	_Vector(&vector),
+	_Next(0),
+	_Decoded(0)
+{}
+
+bool Next(Value& rtn) noexcept
+{
+	if (_Next == _Vector->Size())
+		return false;
+	if (_Next >= _Decoded)
+	{
+		const u64 block = _Next / PackedIntVector::BLOCK_LENGTH;
+		_Decoded = block * PackedIntVector::BLOCK_LENGTH + _Vector->DecodeBlock(block, _Buffer);
+	}
+	rtn = _Buffer[_Next++ % PackedIntVector::BLOCK_LENGTH];
+	return true;
+}
+
+u64 Discard(const u64 count) noexcept
+{
+	const u64 skipped = count < _Vector->Size() - _Next ? count : _Vector->Size() - _Next;
+	_Next += skipped;
+	return skipped;
+}
+
+i64 Remaining(void) const noexcept
+{
+	return (i64)(_Vector->Size() - _Next);
+}
+};
+
+inline PackedIntView PackedIntVector::Stream(void) const noexcept
+{
+	return PackedIntView { *this };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end PACKEDINTVECTOR_HPP
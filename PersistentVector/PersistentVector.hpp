@@ -0,0 +1,877 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef PERSISTENTVECTOR_HPP
+#define PERSISTENTVECTOR_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+
+#include <atomic> // exclusively for std::atomic
+#include <new>    // exclusively for std::bad_alloc
+
+namespace alt // PersistentVector belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: PersistentVector is an immutable vector built on a relaxed radix balanced (RRB) tree of BRANCH_FACTOR-way
+/// nodes.  Every modifier returns a new version in O(log32 n) and leaves the version it was called on untouched, the
+/// two versions sharing every node the modification did not touch.  Nodes are reference counted atomically, so
+/// versions may be handed between threads freely.
+///
+/// NOTE: every branch keeps a cumulative size table, which lets Concat() & Slice() leave nodes partially filled
+/// (relaxed) while lookups still start from the radix guess (index >> shift) and only step forward past short nodes.
+///
+/// NOTE: a Transient edits the nodes it owns exclusively in place instead of path copying them, which makes building a
+/// large vector in a batch several times cheaper.  Ownership is decided by reference count alone, so a Transient never
+/// needs to be invalidated: once a node has been shared with a PersistentVector it is simply copied on the next edit.
+template <typename Datatype>
+class PersistentVector
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+public:
+
+READONLY u32 BRANCH_BITS    = 5;
+READONLY u32 BRANCH_FACTOR  = 1u << BRANCH_BITS;
+READONLY u32 PLAN_INVARIANT = 1;    // concatenation keeps nodes within this many slots of full ...
+READONLY u32 PLAN_EXTRAS    = 2;    // ... except for at most this many extra nodes per level
+
+class Transient;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// NODES
+private:
+
+class _Node
+{
+public:
+	std::atomic<u32> _References;
+	u32              _Count;        // The number of used slots
+};
+
+class _Leaf final:
+	public _Node
+{
+public:
+	Datatype _Elements[BRANCH_FACTOR];
+};
+
+class _Branch final:
+	public _Node
+{
+public:
+	_Node* _Children[BRANCH_FACTOR];
+	u64    _Sizes[BRANCH_FACTOR];       // _Sizes[i] is the number of elements in _Children[0] through _Children[i]
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	_Node* _Root;   // nullptr when empty
+	u64    _Count;  // The number of elements in the PersistentVector
+	u32    _Shift;  // BRANCH_BITS times the height of the tree, zero when the root is a leaf
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+PersistentVector() noexcept:
+	_Root(nullptr),
+	_Count(0),
+	_Shift(0)
+{}
+
+~PersistentVector() noexcept
+{
+	_Release(_Root, _Shift);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
+public:
+
+/// NOTE: O(1), shares every node of 'copy'
+PersistentVector(const PersistentVector& copy) noexcept:
+	_Root(copy._Root),
+	_Count(copy._Count),
+	_Shift(copy._Shift)
+{
+	_Retain(_Root);
+}
+
+PersistentVector(PersistentVector&& move) noexcept:
+	_Root(move._Root),
+	_Count(move._Count),
+	_Shift(move._Shift)
+{
+	move._Root  = nullptr;
+	move._Count = 0;
+	move._Shift = 0;
+}
+
+PersistentVector& operator = (const PersistentVector& copy) noexcept
+{
+	_Retain(copy._Root);
+	_Release(this->_Root, this->_Shift);
+	this->_Root  = copy._Root;
+	this->_Count = copy._Count;
+	this->_Shift = copy._Shift;
+	return *this;
+}
+
+PersistentVector& operator = (PersistentVector&& move) noexcept
+{
+	if (this != &move)
+	{
+		_Release(this->_Root, this->_Shift);
+		this->_Root  = move._Root;
+		this->_Count = move._Count;
+		this->_Shift = move._Shift;
+		move._Root   = nullptr;
+		move._Count  = 0;
+		move._Shift  = 0;
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE ACCESSORS
+public:
+
+u64 Size(void) const noexcept
+{
+	return _Count;
+}
+
+bool Empty(void) const noexcept
+{
+	return _Count == 0;
+}
+
+/// NOTE: the number of levels of the tree, zero when empty
+u32 Height(void) const noexcept
+{
+	return _Root ? _Shift / BRANCH_BITS + 1 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+const Datatype& At(const u64 index) const
+{
+	if (index >= _Count)
+		throw alt::InvalidIndex();
+	return this->operator [] (index);
+}
+
+const Datatype& operator [] (u64 index) const noexcept
+{
+	const _Node* node = _Root;
+	for (u32 shift = _Shift; shift; shift -= BRANCH_BITS)
+	{
+		const _Branch* const branch = (const _Branch*)(node);
+		node = branch->_Children[_Slot(branch, shift, index)];
+	}
+	return ((const _Leaf*)(node))->_Elements[index];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// VERSION MODIFIERS
+public:
+
+/// RTRN: a new version with 'x' appended
+PersistentVector PushBack(const Datatype& x) const
+{
+	PersistentVector rtn = *this;
+	rtn._PushBack(x);
+	return rtn;
+}
+
+/// RTRN: a new version with the element at 'index' replaced by 'x'
+/// NOTE: throws alt::InvalidIndex if 'index' is out of bounds
+PersistentVector Update(const u64 index, const Datatype& x) const
+{
+	if (index >= _Count)
+		throw alt::InvalidIndex();
+	PersistentVector rtn = *this;
+	rtn._Update(index, x);
+	return rtn;
+}
+
+/// RTRN: a new version without its last element, or an empty version if this one is already empty
+PersistentVector PopBack(void) const
+{
+	return Slice(0, _Count ? _Count - 1 : 0);
+}
+
+/// RTRN: a new version holding this version's elements followed by the elements of 'that'
+PersistentVector Concat(const PersistentVector& that) const
+{
+	PersistentVector rtn = *this;
+	rtn._Concat(that);
+	return rtn;
+}
+
+/// RTRN: a new version holding the elements in the range [from, to)
+/// NOTE: throws alt::InvalidIndex unless from <= to <= Size()
+PersistentVector Slice(const u64 from, const u64 to) const
+{
+	if (from > to || to > _Count)
+		throw alt::InvalidIndex();
+	PersistentVector rtn = *this;
+	rtn._Slice(from, to);
+	return rtn;
+}
+
+/// RTRN: a mutable Transient which starts out sharing every node with this version
+Transient ToTransient(void) const
+{
+	return Transient { *this };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// VECTOR OPERATION METHODS
+public:
+
+/// NOTE: O(1) when both versions share a root
+bool Equals(const PersistentVector& that) const noexcept
+{
+	if (this->_Root == that._Root)
+		return true;
+	if (this->_Count != that._Count)
+		return false;
+	for (u64 i = 0; i < this->_Count; i++)
+		if (this->operator [] (i) != that[i])
+			return false;
+	return true;
+}
+
+bool operator == (const PersistentVector& that) const noexcept
+{
+	return this->Equals(that);
+}
+
+/// NOTE: returns the opposite of operator ==
+bool operator != (const PersistentVector& that) const noexcept
+{
+	return ! this->operator == (that);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// TRANSIENT
+public:
+
+/// NOTE: the batch building mode of PersistentVector, see the class notes above
+class Transient final
+{
+private:
+
+	PersistentVector _Vector;
+
+public:
+
+	Transient() noexcept:
+		_Vector()
+	{}
+
+	explicit Transient(const PersistentVector& vector) noexcept:
+		_Vector(vector)
+	{}
+
+	u64 Size(void) const noexcept
+	{
+		return _Vector.Size();
+	}
+
+	const Datatype& At(const u64 index) const
+	{
+		return _Vector.At(index);
+	}
+
+	const Datatype& operator [] (const u64 index) const noexcept
+	{
+		return _Vector[index];
+	}
+
+	void PushBack(const Datatype& x)
+	{
+		_Vector._PushBack(x);
+	}
+
+	/// NOTE: returns true if 'index' is out of bounds
+	bool Update(const u64 index, const Datatype& x)
+	{
+		if (index >= _Vector._Count)
+			return true;
+		_Vector._Update(index, x);
+		return false;
+	}
+
+	void Concat(const PersistentVector& that)
+	{
+		_Vector._Concat(that);
+	}
+
+	/// NOTE: returns true unless from <= to <= Size()
+	bool Slice(const u64 from, const u64 to)
+	{
+		if (from > to || to > _Vector._Count)
+			return true;
+		_Vector._Slice(from, to);
+		return false;
+	}
+
+	/// RTRN: a PersistentVector sharing every node with this Transient, which may keep being edited afterward
+	PersistentVector ToPersistent(void) const noexcept
+	{
+		return _Vector;
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// NODE HELPER METHODS
+private:
+
+static _Leaf* _NewLeaf(void)
+{
+	_Leaf* leaf = nullptr;
+	try
+	{
+		leaf = new _Leaf;
+	}
+	catch (const std::bad_alloc& ba)
+	{
+		throw alt::MallocFailure {};
+	}
+	leaf->_References.store(1, std::memory_order_relaxed);
+	leaf->_Count = 0;
+	return leaf;
+}
+
+static _Branch* _NewBranch(void)
+{
+	_Branch* branch = nullptr;
+	try
+	{
+		branch = new _Branch;
+	}
+	catch (const std::bad_alloc& ba)
+	{
+		throw alt::MallocFailure {};
+	}
+	branch->_References.store(1, std::memory_order_relaxed);
+	branch->_Count = 0;
+	return branch;
+}
+
+static void _Retain(_Node* const node) noexcept
+{
+	if (node)
+		node->_References.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// NOTE: drops one reference to 'node', freeing it & releasing its children if it was the last one
+static void _Release(_Node* const node, const u32 shift) noexcept
+{
+	if (! node || node->_References.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+	if (shift)
+	{
+		_Branch* const branch = (_Branch*)(node);
+		for (u32 i = 0; i < branch->_Count; i++)
+			_Release(branch->_Children[i], shift - BRANCH_BITS);
+		delete branch;
+	}
+	else
+		delete (_Leaf*)(node);
+}
+
+static u64 _SizeOf(const _Node* const node, const u32 shift) noexcept
+{
+	return shift ? ((const _Branch*)(node))->_Sizes[node->_Count - 1] : node->_Count;
+}
+
+static void _SetSizes(_Branch* const branch, const u32 shift) noexcept
+{
+	u64 sum = 0;
+	for (u32 i = 0; i < branch->_Count; i++)
+	{
+		sum += _SizeOf(branch->_Children[i], shift - BRANCH_BITS);
+		branch->_Sizes[i] = sum;
+	}
+}
+
+/// NOTE: returns the slot of 'branch' holding 'index', and rebases 'index' onto that slot's child; the radix guess
+/// never overshoots because no child holds more than 2^shift elements
+static u32 _Slot(const _Branch* const branch, const u32 shift, u64& index) noexcept
+{
+	u32 slot = (u32)(index >> shift);
+	while (branch->_Sizes[slot] <= index)
+		slot++;
+	if (slot)
+		index -= branch->_Sizes[slot - 1];
+	return slot;
+}
+
+/// NOTE: takes over the caller's reference to 'node' and returns a node the caller owns exclusively, which is 'node'
+/// itself if nobody else references it and a shallow copy otherwise
+static _Node* _Edit(_Node* const node, const u32 shift)
+{
+	if (node->_References.load(std::memory_order_acquire) == 1)
+		return node;
+	_Node* copy = nullptr;
+	if (shift)
+	{
+		const _Branch* const branch = (const _Branch*)(node);
+		_Branch* const fresh = _NewBranch();
+		for (u32 i = 0; i < branch->_Count; i++)
+		{
+			fresh->_Children[i] = branch->_Children[i];
+			fresh->_Sizes[i]    = branch->_Sizes[i];
+			_Retain(fresh->_Children[i]);
+		}
+		fresh->_Count = branch->_Count;
+		copy = fresh;
+	}
+	else
+	{
+		const _Leaf* const leaf = (const _Leaf*)(node);
+		_Leaf* const fresh = _NewLeaf();
+		for (u32 i = 0; i < leaf->_Count; i++)
+			fresh->_Elements[i] = leaf->_Elements[i];
+		fresh->_Count = leaf->_Count;
+		copy = fresh;
+	}
+	_Release(node, shift);
+	return copy;
+}
+
+/// NOTE: a fresh chain of single child branches 'shift' deep ending in a leaf holding 'x'
+static _Node* _NewPath(const u32 shift, const Datatype& x)
+{
+	if (! shift)
+	{
+		_Leaf* const leaf = _NewLeaf();
+		leaf->_Elements[0] = x;
+		leaf->_Count = 1;
+		return leaf;
+	}
+	_Branch* const branch = _NewBranch();
+	branch->_Children[0] = _NewPath(shift - BRANCH_BITS, x);
+	branch->_Sizes[0]    = 1;
+	branch->_Count       = 1;
+	return branch;
+}
+
+/// NOTE: a fresh branch one level above 'lhs' (& 'rhs'), taking over the caller's references to them
+static _Branch* _NewAbove(_Node* const lhs, _Node* const rhs, const u32 childShift)
+{
+	_Branch* const branch = _NewBranch();
+	branch->_Children[0] = lhs;
+	branch->_Count       = 1;
+	if (rhs)
+	{
+		branch->_Children[1] = rhs;
+		branch->_Count       = 2;
+	}
+	_SetSizes(branch, childShift + BRANCH_BITS);
+	return branch;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// PUSH & UPDATE HELPER METHODS
+private:
+
+static bool _CanPush(const _Node* const node, const u32 shift) noexcept
+{
+	if (node->_Count < BRANCH_FACTOR)
+		return true;
+	if (! shift)
+		return false;
+	return _CanPush(((const _Branch*)(node))->_Children[node->_Count - 1], shift - BRANCH_BITS);
+}
+
+/// WARN: requires _CanPush(slot, shift)
+static void _PushInto(_Node*& slot, const u32 shift, const Datatype& x)
+{
+	slot = _Edit(slot, shift);
+	if (! shift)
+	{
+		_Leaf* const leaf = (_Leaf*)(slot);
+		leaf->_Elements[leaf->_Count++] = x;
+		return;
+	}
+	_Branch* const branch = (_Branch*)(slot);
+	const u32 last = branch->_Count - 1;
+	if (_CanPush(branch->_Children[last], shift - BRANCH_BITS))
+	{
+		_PushInto(branch->_Children[last], shift - BRANCH_BITS, x);
+		branch->_Sizes[last]++;
+		return;
+	}
+	branch->_Children[last + 1] = _NewPath(shift - BRANCH_BITS, x);
+	branch->_Sizes[last + 1]    = branch->_Sizes[last] + 1;
+	branch->_Count++;
+}
+
+void _PushBack(const Datatype& x)
+{
+	if (! _Root)
+	{
+		_Root  = _NewPath(0, x);
+		_Count = 1;
+		_Shift = 0;
+		return;
+	}
+	if (_CanPush(_Root, _Shift))
+		_PushInto(_Root, _Shift, x);
+	else
+	{
+		_Node* const path = _NewPath(_Shift, x);
+		_Root   = _NewAbove(_Root, path, _Shift);
+		_Shift += BRANCH_BITS;
+	}
+	_Count++;
+}
+
+static void _UpdateIn(_Node*& slot, const u32 shift, u64 index, const Datatype& x)
+{
+	slot = _Edit(slot, shift);
+	if (! shift)
+	{
+		((_Leaf*)(slot))->_Elements[index] = x;
+		return;
+	}
+	_Branch* const branch = (_Branch*)(slot);
+	const u32 child = _Slot(branch, shift, index);
+	_UpdateIn(branch->_Children[child], shift - BRANCH_BITS, index, x);
+}
+
+void _Update(const u64 index, const Datatype& x)
+{
+	_UpdateIn(_Root, _Shift, index, x);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SLICE HELPER METHODS
+private:
+
+/// NOTE: keeps the first 'keep' elements of the subtree in 'slot', 0 < keep <= its size
+static void _TakeIn(_Node*& slot, const u32 shift, const u64 keep)
+{
+	slot = _Edit(slot, shift);
+	if (! shift)
+	{
+		_Leaf* const leaf = (_Leaf*)(slot);
+		for (u32 i = (u32)(keep); i < leaf->_Count; i++)
+			leaf->_Elements[i] = Datatype();
+		leaf->_Count = (u32)(keep);
+		return;
+	}
+	_Branch* const branch = (_Branch*)(slot);
+	u64 index = keep - 1;
+	const u32 last = _Slot(branch, shift, index);
+	for (u32 i = last + 1; i < branch->_Count; i++)
+		_Release(branch->_Children[i], shift - BRANCH_BITS);
+	branch->_Count = last + 1;
+	_TakeIn(branch->_Children[last], shift - BRANCH_BITS, index + 1);
+	branch->_Sizes[last] = keep;
+}
+
+/// NOTE: drops the first 'drop' elements of the subtree in 'slot', 0 < drop < its size
+static void _DropIn(_Node*& slot, const u32 shift, const u64 drop)
+{
+	slot = _Edit(slot, shift);
+	if (! shift)
+	{
+		_Leaf* const leaf = (_Leaf*)(slot);
+		for (u32 i = (u32)(drop); i < leaf->_Count; i++)
+			leaf->_Elements[i - drop] = (Datatype&&)(leaf->_Elements[i]);
+		for (u32 i = leaf->_Count - (u32)(drop); i < leaf->_Count; i++)
+			leaf->_Elements[i] = Datatype();
+		leaf->_Count -= (u32)(drop);
+		return;
+	}
+	_Branch* const branch = (_Branch*)(slot);
+	u64 index = drop;
+	const u32 first = _Slot(branch, shift, index);
+	for (u32 i = 0; i < first; i++)
+		_Release(branch->_Children[i], shift - BRANCH_BITS);
+	for (u32 i = first; i < branch->_Count; i++)
+	{
+		branch->_Children[i - first] = branch->_Children[i];
+		branch->_Sizes[i - first]    = branch->_Sizes[i] - drop;
+	}
+	branch->_Count -= first;
+	if (index)
+		_DropIn(branch->_Children[0], shift - BRANCH_BITS, index);
+}
+
+/// NOTE: replaces a root with a single child by that child until the root is a leaf or has two children
+void _Collapse(void)
+{
+	while (_Shift && _Root->_Count == 1)
+	{
+		_Node* const child = ((_Branch*)(_Root))->_Children[0];
+		_Retain(child);
+		_Release(_Root, _Shift);
+		_Root   = child;
+		_Shift -= BRANCH_BITS;
+	}
+}
+
+void _Slice(const u64 from, const u64 to)
+{
+	if (from == to)
+	{
+		_Release(_Root, _Shift);
+		_Root  = nullptr;
+		_Count = 0;
+		_Shift = 0;
+		return;
+	}
+	if (to < _Count)
+		_TakeIn(_Root, _Shift, to);
+	if (from)
+		_DropIn(_Root, _Shift, from);
+	_Count = to - from;
+	_Collapse();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONCAT HELPER METHODS
+private:
+
+/// NOTE: the concatenation plan of Bagwell & Rompf / L'orange, which redistributes the slots of 'all' until at most
+/// PLAN_EXTRAS more nodes than optimal remain, merging only the short nodes it finds
+/// RTRN: the number of nodes the redistributed slots will occupy, with their slot counts written into 'plan'
+static u32 _Plan(_Node* const* const all, const u32 count, u32* const plan) noexcept
+{
+	u32 total = 0;
+	for (u32 i = 0; i < count; i++)
+	{
+		plan[i] = all[i]->_Count;
+		total  += plan[i];
+	}
+	const u32 optimal = (total - 1) / BRANCH_FACTOR + 1;
+	u32 length = count;
+	u32 i = 0;
+	while (optimal + PLAN_EXTRAS < length)
+	{
+		while (plan[i] > BRANCH_FACTOR - PLAN_INVARIANT)
+			i++;
+		u32 remaining = plan[i];
+		do
+		{
+			const u32 size = remaining + plan[i + 1] < BRANCH_FACTOR ? remaining + plan[i + 1] : BRANCH_FACTOR;
+			remaining = remaining + plan[i + 1] - size;
+			plan[i]   = size;
+			i++;
+		}
+		while (remaining > 0);
+		for (u32 j = i; j < length - 1; j++)
+			plan[j] = plan[j + 1];
+		length--;
+		i--;
+	}
+	return length;
+}
+
+/// NOTE: builds the nodes described by 'plan' out of the slots of 'all' (which sit 'shift' - BRANCH_BITS deep),
+/// reusing every node the plan leaves as it is
+static void _Execute(_Node* const* const all, const u32* const plan, const u32 length, const u32 shift,
+                     _Node** const out)
+{
+	const u32 childShift = shift - BRANCH_BITS;
+	u32 index  = 0;
+	u32 offset = 0;
+	for (u32 i = 0; i < length; i++)
+	{
+		if (offset == 0 && plan[i] == all[index]->_Count)
+		{
+			_Retain(all[index]);
+			out[i] = all[index++];
+			continue;
+		}
+		_Node* fresh = childShift ? (_Node*)(_NewBranch()) : (_Node*)(_NewLeaf());
+		while (fresh->_Count < plan[i])
+		{
+			const _Node* const old = all[index];
+			const u32 available = old->_Count - offset;
+			const u32 needed    = plan[i] - fresh->_Count;
+			const u32 moved     = available < needed ? available : needed;
+			for (u32 j = 0; j < moved; j++)
+			{
+				if (childShift)
+				{
+					_Node* const grandchild = ((const _Branch*)(old))->_Children[offset + j];
+					_Retain(grandchild);
+					((_Branch*)(fresh))->_Children[fresh->_Count + j] = grandchild;
+				}
+				else
+					((_Leaf*)(fresh))->_Elements[fresh->_Count + j] = ((const _Leaf*)(old))->_Elements[offset + j];
+			}
+			fresh->_Count += moved;
+			offset        += moved;
+			if (offset == old->_Count)
+			{
+				index++;
+				offset = 0;
+			}
+		}
+		if (childShift)
+			_SetSizes((_Branch*)(fresh), childShift);
+		out[i] = fresh;
+	}
+}
+
+/// NOTE: merges the slots of 'lhs' (all but its last), 'centre', & 'rhs' (all but its first), any of which but
+/// 'centre' may be nullptr, into rebalanced nodes 'shift' deep
+/// RTRN: a new node at 'shift' when 'top' & everything fits in one node, otherwise a new node at 'shift' + BRANCH_BITS
+static _Branch* _Rebalance(const _Branch* const lhs, const _Branch* const centre, const _Branch* const rhs,
+                           const u32 shift, const bool top, u32& rtnShift)
+{
+	_Node* all[3 * BRANCH_FACTOR];
+	u32 count = 0;
+	if (lhs)
+		for (u32 i = 0; i + 1 < lhs->_Count; i++)
+			all[count++] = lhs->_Children[i];
+	for (u32 i = 0; i < centre->_Count; i++)
+		all[count++] = centre->_Children[i];
+	if (rhs)
+		for (u32 i = 1; i < rhs->_Count; i++)
+			all[count++] = rhs->_Children[i];
+
+	u32 plan[3 * BRANCH_FACTOR];
+	const u32 length = _Plan(all, count, plan);
+	_Node* out[3 * BRANCH_FACTOR];
+	_Execute(all, plan, length, shift, out);
+
+	if (length <= BRANCH_FACTOR)
+	{
+		_Branch* const branch = _NewBranch();
+		for (u32 i = 0; i < length; i++)
+			branch->_Children[i] = out[i];
+		branch->_Count = length;
+		_SetSizes(branch, shift);
+		if (top)
+		{
+			rtnShift = shift;
+			return branch;
+		}
+		rtnShift = shift + BRANCH_BITS;
+		return _NewAbove(branch, nullptr, shift);
+	}
+	_Branch* const left  = _NewBranch();
+	_Branch* const right = _NewBranch();
+	for (u32 i = 0; i < BRANCH_FACTOR; i++)
+		left->_Children[i] = out[i];
+	for (u32 i = BRANCH_FACTOR; i < length; i++)
+		right->_Children[i - BRANCH_FACTOR] = out[i];
+	left->_Count  = BRANCH_FACTOR;
+	right->_Count = length - BRANCH_FACTOR;
+	_SetSizes(left, shift);
+	_SetSizes(right, shift);
+	rtnShift = shift + BRANCH_BITS;
+	return _NewAbove(left, right, shift);
+}
+
+/// NOTE: concatenates the subtrees 'lhs' & 'rhs' without consuming either of them
+static _Branch* _ConcatIn(const _Node* const lhs, const u32 lhsShift, const _Node* const rhs, const u32 rhsShift,
+                          const bool top, u32& rtnShift)
+{
+	if (lhsShift > rhsShift)
+	{
+		const _Branch* const branch = (const _Branch*)(lhs);
+		u32 centreShift = 0;
+		_Branch* const centre = _ConcatIn(branch->_Children[branch->_Count - 1], lhsShift - BRANCH_BITS,
+		                                  rhs, rhsShift, false, centreShift);
+		_Branch* const rtn = _Rebalance(branch, centre, nullptr, lhsShift, top, rtnShift);
+		_Release(centre, centreShift);
+		return rtn;
+	}
+	if (lhsShift < rhsShift)
+	{
+		const _Branch* const branch = (const _Branch*)(rhs);
+		u32 centreShift = 0;
+		_Branch* const centre = _ConcatIn(lhs, lhsShift, branch->_Children[0], rhsShift - BRANCH_BITS,
+		                                  false, centreShift);
+		_Branch* const rtn = _Rebalance(nullptr, centre, branch, rhsShift, top, rtnShift);
+		_Release(centre, centreShift);
+		return rtn;
+	}
+	if (! lhsShift)
+	{
+		rtnShift = BRANCH_BITS;
+		if (top && lhs->_Count + rhs->_Count <= BRANCH_FACTOR)
+		{
+			_Leaf* const merged = _NewLeaf();
+			for (u32 i = 0; i < lhs->_Count; i++)
+				merged->_Elements[i] = ((const _Leaf*)(lhs))->_Elements[i];
+			for (u32 i = 0; i < rhs->_Count; i++)
+				merged->_Elements[lhs->_Count + i] = ((const _Leaf*)(rhs))->_Elements[i];
+			merged->_Count = lhs->_Count + rhs->_Count;
+			return _NewAbove(merged, nullptr, 0);
+		}
+		_Retain((_Node*)(lhs));
+		_Retain((_Node*)(rhs));
+		return _NewAbove((_Node*)(lhs), (_Node*)(rhs), 0);
+	}
+	const _Branch* const lhsBranch = (const _Branch*)(lhs);
+	const _Branch* const rhsBranch = (const _Branch*)(rhs);
+	u32 centreShift = 0;
+	_Branch* const centre = _ConcatIn(lhsBranch->_Children[lhsBranch->_Count - 1], lhsShift - BRANCH_BITS,
+	                                  rhsBranch->_Children[0], rhsShift - BRANCH_BITS, false, centreShift);
+	_Branch* const rtn = _Rebalance(lhsBranch, centre, rhsBranch, lhsShift, top, rtnShift);
+	_Release(centre, centreShift);
+	return rtn;
+}
+
+void _Concat(const PersistentVector& that)
+{
+	if (! that._Root)
+		return;
+	if (! this->_Root)
+	{
+		*this = that;
+		return;
+	}
+	u32 shift = 0;
+	_Branch* const root = _ConcatIn(this->_Root, this->_Shift, that._Root, that._Shift, true, shift);
+	_Release(this->_Root, this->_Shift);
+	this->_Root   = root;
+	this->_Shift  = shift;
+	this->_Count += that._Count;
+	_Collapse();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end PERSISTENTVECTOR_HPP
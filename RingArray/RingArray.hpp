@@ -0,0 +1,246 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef RINGARRAY_HPP
+#define RINGARRAY_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+
+namespace alt // RingArray belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: RingArray has alt::Array's fixed inline storage & queue API, but keeps its elements in a ring, so Push(),
+/// Enqueue(), Pop(), PopBack(), Peek(), & PeekBack() are all O(1) instead of shifting every element.  Its capacity
+/// must be a power of two so a logical index maps onto its slot with a single mask.  Like Array it is a literal type
+/// whenever Datatype is.
+template <typename Datatype, i64 _Capacity>
+class RingArray
+{
+static_assert(_Capacity > 0 && (_Capacity & (_Capacity - 1)) == 0, "RingArray capacity must be a power of two");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+READONLY i64 MASK = _Capacity - 1;
+
+	i64 _Head;
+	i64 _Count;
+	Datatype _Array[_Capacity];
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR
+public:
+
+constexpr RingArray() noexcept:
+	_Head(0),
+	_Count(0),
+	_Array{}
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+constexpr i64 Count(void) const noexcept
+{
+	return _Count;
+}
+
+constexpr i64 Capacity(void) const noexcept
+{
+	return _Capacity;
+}
+
+constexpr bool Empty(void) const noexcept
+{
+	return (_Count == 0);
+}
+
+constexpr bool Full(void) const noexcept
+{
+	return (_Count == _Capacity);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+constexpr const Datatype& At(const i64 index) const
+{
+	if (index < 0 || _Count <= index)
+		throw alt::InvalidIndex();
+	return _Array[_Slot(index)];
+}
+
+constexpr Datatype& At(const i64 index)
+{
+	if (index < 0 || _Count <= index)
+		throw alt::InvalidIndex();
+	return _Array[_Slot(index)];
+}
+
+constexpr const Datatype& operator [] (const i64 index) const noexcept
+{
+	return _Array[_Slot(index)];
+}
+
+constexpr Datatype& operator [] (const i64 index) noexcept
+{
+	return _Array[_Slot(index)];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEARCH METHODS
+public:
+
+constexpr bool Contains(const Datatype& x) const noexcept
+{
+	return IndexOf(x) != -1;
+}
+
+constexpr i64 IndexOf(const Datatype& x) const noexcept
+{
+	for (i64 i = 0; i < _Count; i++)
+		if (_Array[_Slot(i)] == x)
+			return i;
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: pushes onto the front, like Array::Push()
+constexpr bool Push(const Datatype& x) noexcept
+{
+	if (Full())
+		return true;
+	_Head = (_Head - 1) & MASK;
+	_Array[_Head] = x;
+	_Count++;
+	return false;
+}
+
+constexpr bool Enqueue(const Datatype& x) noexcept
+{
+	if (Full())
+		return true;
+	_Array[_Slot(_Count)] = x;
+	_Count++;
+	return false;
+}
+
+constexpr bool operator += (const Datatype& x) noexcept
+{
+	return Enqueue(x);
+}
+
+constexpr const Datatype& Peek(void) const
+{
+	return At(0);
+}
+
+constexpr Datatype& Peek(void)
+{
+	return At(0);
+}
+
+constexpr const Datatype& PeekBack(void) const
+{
+	return At(_Count - 1);
+}
+
+constexpr Datatype& PeekBack(void)
+{
+	return At(_Count - 1);
+}
+
+constexpr bool Pop(Datatype& rtn) noexcept
+{
+	if (Empty())
+		return true;
+	rtn = (Datatype&&)(_Array[_Head]);
+	_Head = (_Head + 1) & MASK;
+	_Count--;
+	return false;
+}
+
+constexpr bool PopBack(Datatype& rtn) noexcept
+{
+	if (Empty())
+		return true;
+	_Count--;
+	rtn = (Datatype&&)(_Array[_Slot(_Count)]);
+	return false;
+}
+
+constexpr void Erase(void) noexcept
+{
+	_Head  = 0;
+	_Count = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// RING ARRAY OPERATION METHODS
+public:
+
+constexpr bool Equals(const RingArray& that) const noexcept
+{
+	if (this->_Count != that._Count)
+		return false;
+	for (i64 i = 0; i < _Count; i++)
+		if (this->operator [] (i) != that[i])
+			return false;
+	return true;
+}
+
+constexpr bool operator == (const RingArray& that) const noexcept
+{
+	return this->Equals(that);
+}
+
+/// NOTE: returns the opposite of operator ==
+constexpr bool operator != (const RingArray& that) const noexcept
+{
+	return ! this->operator == (that);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// INDEXING HELPER METHOD
+private:
+
+constexpr i64 _Slot(const i64 index) const noexcept
+{
+	return (_Head + index) & MASK;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end RINGARRAY_HPP
@@ -0,0 +1,340 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef SEGMENTEDVECTOR_HPP
+#define SEGMENTEDVECTOR_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Allocator.hpp"
+#include "Bits.hpp"
+
+namespace alt // SegmentedVector belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: SegmentedVector stores its elements in a table of power-of-two sized segments, segment k holding
+/// 2^(k + FIRST_SEGMENT_BITS) elements.  Growing allocates one new segment and never moves an existing element, so
+/// pointers & references into a SegmentedVector stay valid until the element they refer to is popped, and a PushBack
+/// never costs more than one allocation.  Element 'index' lives in segment floor(log2(index + FIRST_SEGMENT_LENGTH))
+/// - FIRST_SEGMENT_BITS, which is a single count-leading-zeros instruction.
+template < typename Datatype, class Allocator = alt::Allocator<Datatype> >
+class SegmentedVector
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+public:
+
+READONLY u32 FIRST_SEGMENT_BITS   = 4;
+READONLY u32 FIRST_SEGMENT_LENGTH = 1u << FIRST_SEGMENT_BITS;
+READONLY u32 SEGMENT_TABLE_LENGTH = 32 - FIRST_SEGMENT_BITS;
+READONLY u32 MAXIMUM_CAPACITY     = 0xFFFFFFFFu - FIRST_SEGMENT_LENGTH + 1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	u32       _Count;                           // The number of elements in the SegmentedVector
+	u32       _Segments;                        // The number of allocated segments
+	Allocator _Allocator;                       // The memory Allocator of the SegmentedVector
+	Datatype* _Table[SEGMENT_TABLE_LENGTH];     // The segments, only the first _Segments are allocated
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+SegmentedVector() noexcept:
+	_Count(0),
+	_Segments(0),
+	_Allocator(),
+	_Table{nullptr}
+{}
+
+~SegmentedVector() noexcept
+{
+	_Free(0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
+public:
+
+SegmentedVector(const SegmentedVector& copy):
+	_Count(0),
+	_Segments(0),
+	_Allocator(copy._Allocator),
+	_Table{nullptr}
+{
+	_CopyFrom(copy);
+}
+
+SegmentedVector(SegmentedVector&& move) noexcept:
+	_Count(move._Count),
+	_Segments(move._Segments),
+	_Allocator((Allocator&&)(move._Allocator)),
+	_Table{nullptr}
+{
+	for (u32 k = 0; k < _Segments; k++)
+	{
+		_Table[k]      = move._Table[k];
+		move._Table[k] = nullptr;
+	}
+	move._Count    = 0;
+	move._Segments = 0;
+}
+
+SegmentedVector& operator = (const SegmentedVector& copy)
+{
+	if (this != &copy)
+	{
+		this->_Count = 0;
+		this->_CopyFrom(copy);
+	}
+	return *this;
+}
+
+SegmentedVector& operator = (SegmentedVector&& move) noexcept
+{
+	if (this != &move)
+	{
+		this->_Free(0);
+		for (u32 k = 0; k < move._Segments; k++)
+		{
+			this->_Table[k] = move._Table[k];
+			move._Table[k]  = nullptr;
+		}
+		this->_Count    = move._Count;
+		this->_Segments = move._Segments;
+		move._Count     = 0;
+		move._Segments  = 0;
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+u32 Size(void) const noexcept
+{
+	return _Count;
+}
+
+u32 Capacity(void) const noexcept
+{
+	return _SegmentStart(_Segments);
+}
+
+bool Empty(void) const noexcept
+{
+	return _Count == 0;
+}
+
+bool Full(void) const noexcept
+{
+	return _Count == MAXIMUM_CAPACITY;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY MODIFIERS
+public:
+
+/// NOTE: allocates segments until the SegmentedVector can hold 'capacity' elements, returns true if it already could
+/// or if 'capacity' exceeds MAXIMUM_CAPACITY
+bool Reserve(const u32 capacity)
+{
+	if (capacity <= Capacity() || capacity > MAXIMUM_CAPACITY)
+		return true;
+	while (Capacity() < capacity)
+		_Append();
+	return false;
+}
+
+/// NOTE: frees every segment past the one holding the last element, returns true if there were none to free
+bool Shrink(void) noexcept
+{
+	const u32 keep = _Count ? _SegmentOf(_Count - 1) + 1 : 0;
+	if (keep == _Segments)
+		return true;
+	_Free(keep);
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+const Datatype& At(const u32 index) const
+{
+	if (index >= _Count)
+		throw alt::InvalidIndex();
+	return this->operator [] (index);
+}
+
+Datatype& At(const u32 index)
+{
+	if (index >= _Count)
+		throw alt::InvalidIndex();
+	return this->operator [] (index);
+}
+
+const Datatype& operator [] (const u32 index) const noexcept
+{
+	const u32 segment = _SegmentOf(index);
+	return _Table[segment][index - _SegmentStart(segment)];
+}
+
+Datatype& operator [] (const u32 index) noexcept
+{
+	const u32 segment = _SegmentOf(index);
+	return _Table[segment][index - _SegmentStart(segment)];
+}
+
+const Datatype& PeekBack(void) const
+{
+	return At(_Count - 1);
+}
+
+Datatype& PeekBack(void)
+{
+	return At(_Count - 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEGMENT ACCESSORS
+public:
+
+/// NOTE: the number of segments which hold at least one element, iterate Segment(k) over [0, SegmentCount()) with
+/// SegmentSize(k) elements each for tight bulk loops
+u32 SegmentCount(void) const noexcept
+{
+	return _Count ? _SegmentOf(_Count - 1) + 1 : 0;
+}
+
+/// NOTE: the number of elements held in 'segment'
+u32 SegmentSize(const u32 segment) const noexcept
+{
+	const u32 start = _SegmentStart(segment);
+	if (_Count <= start)
+		return 0;
+	const u32 length = SegmentLength(segment);
+	return _Count - start < length ? _Count - start : length;
+}
+
+const Datatype* Segment(const u32 segment) const noexcept
+{
+	return segment < _Segments ? _Table[segment] : nullptr;
+}
+
+Datatype* Segment(const u32 segment) noexcept
+{
+	return segment < _Segments ? _Table[segment] : nullptr;
+}
+
+static u32 SegmentLength(const u32 segment) noexcept
+{
+	return FIRST_SEGMENT_LENGTH << segment;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: never moves an existing element, at most allocates one new segment
+bool PushBack(const Datatype& x)
+{
+	if (Full())
+		return true;
+	if (_Count == Capacity())
+		_Append();
+	this->operator [] (_Count) = x;
+	_Count++;
+	return false;
+}
+
+bool PopBack(Datatype& rtn)
+{
+	if (Empty())
+		return true;
+	_Count--;
+	rtn = (Datatype&&)(this->operator [] (_Count));
+	return false;
+}
+
+/// NOTE: keeps every segment allocated, call Shrink() afterward to release them
+void Erase(void) noexcept
+{
+	_Count = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SEGMENT HELPER METHODS
+private:
+
+static u32 _SegmentOf(const u32 index) noexcept
+{
+	return alt::Log2Floor((u64)(index) + FIRST_SEGMENT_LENGTH) - FIRST_SEGMENT_BITS;
+}
+
+/// NOTE: the index of the first element of 'segment', equivalently the capacity of all the segments before it
+static u32 _SegmentStart(const u32 segment) noexcept
+{
+	return (u32)(((u64)(FIRST_SEGMENT_LENGTH) << segment) - FIRST_SEGMENT_LENGTH);
+}
+
+void _Append(void)
+{
+	_Table[_Segments] = _Allocator.Allocate(SegmentLength(_Segments));
+	_Segments++;
+}
+
+void _Free(const u32 keep) noexcept
+{
+	while (_Segments > keep)
+	{
+		_Segments--;
+		_Allocator.Deallocate(_Table[_Segments]);
+	}
+}
+
+void _CopyFrom(const SegmentedVector& copy)
+{
+	const u32 segments = copy.SegmentCount();
+	while (_Segments < segments)
+		_Append();
+	for (u32 k = 0; k < segments; k++)
+	{
+		const u32 size = copy.SegmentSize(k);
+		for (u32 i = 0; i < size; i++)
+			_Table[k][i] = copy._Table[k][i];
+	}
+	_Count = copy._Count;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end SEGMENTEDVECTOR_HPP
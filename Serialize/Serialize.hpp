@@ -0,0 +1,453 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef SERIALIZE_HPP
+#define SERIALIZE_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Array.hpp"
+#include "Vector.hpp"
+
+#include <cerrno>      // exclusively for errno & EINTR
+#include <cstring>     // exclusively for std::memcpy()
+#include <type_traits> // exclusively for std::is_trivially_copyable
+
+#ifdef _MSC_VER     // if we're using the Microsoft C++ Compiler (cl.exe)
+#include <io.h>        // exclusively for ::_read(), ::_write(), & ::_lseeki64()
+#include <cstdio>      // exclusively for SEEK_CUR
+#else   // if we're using any other compiler
+#include <sys/uio.h>   // exclusively for ::writev() & struct iovec
+#include <unistd.h>    // exclusively for ::read(), ::write(), & ::lseek()
+#endif // _MSC_VER
+
+namespace alt // Serialize belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FILE DESCRIPTOR I/O
+
+#ifdef _MSC_VER
+
+/// NOTE: the CRT's descriptor I/O takes an unsigned int count, so a single call moves at most INT_MAX bytes & the
+/// callers loop over short transfers anyway
+READONLY u64 _SERIAL_IO_MAXIMUM = 0x7FFFFFFF;
+
+inline i64 _SerialRead(const i32 file, void* const bytes, const u64 count) noexcept
+{
+	return ::_read(file, bytes, (u32)(count < _SERIAL_IO_MAXIMUM ? count : _SERIAL_IO_MAXIMUM));
+}
+
+inline i64 _SerialWrite(const i32 file, const void* const bytes, const u64 count) noexcept
+{
+	return ::_write(file, bytes, (u32)(count < _SERIAL_IO_MAXIMUM ? count : _SERIAL_IO_MAXIMUM));
+}
+
+/// NOTE: moves the file offset by 'offset' bytes, returns true on error
+inline bool _SerialSkip(const i32 file, const i64 offset) noexcept
+{
+	return ::_lseeki64(file, offset, SEEK_CUR) < 0;
+}
+
+#else
+
+inline i64 _SerialRead(const i32 file, void* const bytes, const u64 count) noexcept
+{
+	return ::read(file, bytes, count);
+}
+
+inline i64 _SerialWrite(const i32 file, const void* const bytes, const u64 count) noexcept
+{
+	return ::write(file, bytes, count);
+}
+
+/// NOTE: moves the file offset by 'offset' bytes, returns true on error
+inline bool _SerialSkip(const i32 file, const i64 offset) noexcept
+{
+	return ::lseek(file, (off_t)(offset), SEEK_CUR) < 0;
+}
+
+#endif // _MSC_VER
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: every serialized container starts with this header, followed by its elements.  Raw elements are written as
+/// one contiguous payload of Count * ElementSize bytes, everything else as whatever its alt::Serializer writes.
+class SerialHeader
+{
+public:
+
+READONLY u32 MAGIC   = 0x53544C41; // "ALTS" on a little endian machine
+READONLY u16 VERSION = 1;
+
+	u32 _Magic;
+	u16 _Version;
+	u8  _LittleEndian;
+	u8  _Raw;
+	u32 _ElementSize;
+	u32 _Reserved;
+	u64 _Count;
+
+static bool NativeLittleEndian(void) noexcept
+{
+	const u16 one = 1;
+	u8 low;
+	std::memcpy(&low, &one, sizeof(low));
+	return low == 1;
+}
+
+static SerialHeader Make(const u64 count, const u32 elementSize, const bool raw) noexcept
+{
+	return SerialHeader { MAGIC, VERSION, (u8)(NativeLittleEndian()), (u8)(raw), elementSize, 0, count };
+}
+
+/// NOTE: a header only matches if it was written by this version, on a machine of the same endianness, for elements
+/// of the same size & serialized the same way
+bool Matches(const u32 elementSize, const bool raw) const noexcept
+{
+	return _Magic        == MAGIC                      &&
+	       _Version      == VERSION                    &&
+	       _LittleEndian == (u8)(NativeLittleEndian()) &&
+	       _Raw          == (u8)(raw)                  &&
+	       _ElementSize  == elementSize;
+}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: buffered output to a file descriptor, handed to each alt::Serializer::Save() hook
+class SerialWriter
+{
+private:
+
+READONLY u32 BUFFER_SIZE = 16384;
+
+	i32 _File;
+	u32 _Used;
+	u8  _Buffer[BUFFER_SIZE];
+
+public:
+
+explicit SerialWriter(const i32 file) noexcept:
+	_File(file),
+	_Used(0)
+{}
+
+/// NOTE: returns true if the bytes could not be written
+bool Write(const void* const bytes, const u64 count) noexcept
+{
+	if (count >= BUFFER_SIZE)
+		return Flush() || WriteAll(_File, bytes, count);
+	if (count > BUFFER_SIZE - _Used && Flush())
+		return true;
+	std::memcpy(_Buffer + _Used, bytes, count);
+	_Used += (u32)(count);
+	return false;
+}
+
+template <typename Datatype>
+bool Write(const Datatype& x) noexcept
+{
+	static_assert(std::is_trivially_copyable<Datatype>::value, "SerialWriter::Write() copies raw bytes");
+	return Write(&x, sizeof(x));
+}
+
+bool Flush(void) noexcept
+{
+	const u32 used = _Used;
+	_Used = 0;
+	return used && WriteAll(_File, _Buffer, used);
+}
+
+/// NOTE: writes 'count' bytes, retrying short writes & interrupts, returns true on any other error
+static bool WriteAll(const i32 file, const void* const bytes, const u64 count) noexcept
+{
+	const u8* next = (const u8*)(bytes);
+	const u8* const end = next + count;
+	while (next < end)
+	{
+		const i64 written = _SerialWrite(file, next, (u64)(end - next));
+		if (written < 0 && errno == EINTR)
+			continue;
+		if (written <= 0)
+			return true;
+		next += written;
+	}
+	return false;
+}
+
+/// NOTE: writes the header & payload with a single writev() unless the kernel writes them short, returns true on error.
+/// MSVC has no gather write, so there they go out as two plain writes.
+static bool WriteAll(const i32 file, const SerialHeader& header, const void* const payload, const u64 count) noexcept
+{
+#ifdef _MSC_VER
+	return WriteAll(file, &header, sizeof(header)) || WriteAll(file, payload, count);
+#else
+	iovec parts[2] = { { (void*)(&header), sizeof(header) }, { (void*)(payload), count } };
+	i32 first = 0;
+	while (first < 2)
+	{
+		const i64 written = ::writev(file, parts + first, 2 - first);
+		if (written < 0 && errno == EINTR)
+			continue;
+		if (written <= 0)
+			return true;
+		u64 left = (u64)(written);
+		for (; first < 2 && left >= parts[first].iov_len; first++)
+			left -= parts[first].iov_len;
+		if (first < 2)
+		{
+			parts[first].iov_base = (u8*)(parts[first].iov_base) + left;
+			parts[first].iov_len -= left;
+		}
+	}
+	return false;
+#endif // _MSC_VER
+}
+};
+
+/// NOTE: buffered input from a file descriptor, handed to each alt::Serializer::Load() hook.  A refill can read past
+/// the end of the record being loaded, so the reader seeks back over whatever it buffered but didn't hand out when it's
+/// released, which leaves the file at the start of the next record.
+///
+/// WARN: the file must be seekable (e.g. not a pipe or socket) for records after a non-raw one to be loaded
+class SerialReader
+{
+private:
+
+READONLY u32 BUFFER_SIZE = 16384;
+
+	i32 _File;
+	u32 _Next;
+	u32 _Used;
+	u8  _Buffer[BUFFER_SIZE];
+
+public:
+
+explicit SerialReader(const i32 file) noexcept:
+	_File(file),
+	_Next(0),
+	_Used(0)
+{}
+
+~SerialReader() noexcept
+{
+	Release();
+}
+
+SerialReader(const SerialReader& copy) = delete;
+SerialReader& operator = (const SerialReader& copy) = delete;
+
+/// NOTE: gives the buffered but unread bytes back to the file, returns true if that's needed but the file can't seek
+bool Release(void) noexcept
+{
+	const u32 unread = _Used - _Next;
+	_Next = 0;
+	_Used = 0;
+	return unread && _SerialSkip(_File, -(i64)(unread));
+}
+
+/// NOTE: returns true if 'count' bytes could not be read
+bool Read(void* const bytes, const u64 count) noexcept
+{
+	u8* next = (u8*)(bytes);
+	u64 left = count;
+	const u32 buffered = _Used - _Next < left ? _Used - _Next : (u32)(left);
+	std::memcpy(next, _Buffer + _Next, buffered);
+	_Next += buffered;
+	next  += buffered;
+	left  -= buffered;
+	if (! left)
+		return false;
+	if (left >= BUFFER_SIZE)
+		return ReadAll(_File, next, left);
+	_Next = 0;
+	_Used = 0;
+	while (_Used < left)
+	{
+		const i64 got = _SerialRead(_File, _Buffer + _Used, BUFFER_SIZE - _Used);
+		if (got < 0 && errno == EINTR)
+			continue;
+		if (got <= 0)
+			return true;
+		_Used += (u32)(got);
+	}
+	std::memcpy(next, _Buffer, left);
+	_Next = (u32)(left);
+	return false;
+}
+
+template <typename Datatype>
+bool Read(Datatype& x) noexcept
+{
+	static_assert(std::is_trivially_copyable<Datatype>::value, "SerialReader::Read() copies raw bytes");
+	return Read(&x, sizeof(x));
+}
+
+/// NOTE: reads exactly 'count' bytes, retrying short reads & interrupts, returns true on end of file or error
+static bool ReadAll(const i32 file, void* const bytes, const u64 count) noexcept
+{
+	u8* next = (u8*)(bytes);
+	u8* const end = next + count;
+	while (next < end)
+	{
+		const i64 got = _SerialRead(file, next, (u64)(end - next));
+		if (got < 0 && errno == EINTR)
+			continue;
+		if (got <= 0)
+			return true;
+		next += got;
+	}
+	return false;
+}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: Serializer decides how a Datatype is written by alt::Save() & read by alt::Load().  Raw types are copied as
+/// one contiguous block of bytes, which is every trivially copyable type by default.  Specialize it to opt another
+/// type into raw copies, or to give a non-trivial type per-element Save() & Load() hooks.
+template <typename Datatype, typename Enable = void>
+class Serializer
+{
+public:
+
+READONLY bool Raw = std::is_trivially_copyable<Datatype>::value;
+
+static bool Save(SerialWriter& out, const Datatype& x) noexcept
+{
+	static_assert(Raw, "specialize alt::Serializer to save a type which isn't trivially copyable");
+	return out.Write(&x, sizeof(x));
+}
+
+static bool Load(SerialReader& in, Datatype& x) noexcept
+{
+	static_assert(Raw, "specialize alt::Serializer to load a type which isn't trivially copyable");
+	return in.Read(&x, sizeof(x));
+}
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: the shared body of the alt::Save() overloads, raw payloads go out with the header in one writev()
+template <typename Datatype>
+bool _SaveElements(const i32 file, const Datatype* const elements, const u64 count)
+{
+	using Hook = Serializer<Datatype>;
+	const SerialHeader header = SerialHeader::Make(count, sizeof(Datatype), Hook::Raw);
+	if constexpr (Hook::Raw)
+		return SerialWriter::WriteAll(file, header, elements, count * sizeof(Datatype));
+	else
+	{
+		SerialWriter out(file);
+		if (out.Write(header))
+			return true;
+		for (u64 i = 0; i < count; i++)
+			if (Hook::Save(out, elements[i]))
+				return true;
+		return out.Flush();
+	}
+}
+
+/// NOTE: the shared body of the alt::Load() overloads, 'extend' makes room for the header's count & returns the first
+/// new element, or nullptr if there isn't room
+template <typename Datatype, typename Extend>
+bool _LoadElements(const i32 file, Extend extend)
+{
+	using Hook = Serializer<Datatype>;
+	SerialHeader header;
+	if constexpr (Hook::Raw)
+	{
+		if (SerialReader::ReadAll(file, &header, sizeof(header)) ||
+			! header.Matches(sizeof(Datatype), true))
+			return true;
+		if (! header._Count)
+			return false;
+		Datatype* const elements = extend(header._Count);
+		return ! elements || SerialReader::ReadAll(file, elements, header._Count * sizeof(Datatype));
+	}
+	else
+	{
+		SerialReader in(file);
+		if (in.Read(header) ||
+			! header.Matches(sizeof(Datatype), false))
+			return true;
+		if (! header._Count)
+			return in.Release();
+		Datatype* const elements = extend(header._Count);
+		if (! elements)
+			return true;
+		for (u64 i = 0; i < header._Count; i++)
+			if (Hook::Load(in, elements[i]))
+				return true;
+		return in.Release();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: writes 'vector' to 'file', returns true if any write fails
+template <typename Datatype, class... Policies>
+bool Save(const i32 file, const Vector<Datatype, Policies...>& vector)
+{
+	return _SaveElements(file, vector.Data(), vector.Size());
+}
+
+template <typename Datatype, i64 Capacity>
+bool Save(const i32 file, const Array<Datatype, Capacity>& array)
+{
+	return _SaveElements(file, &array[0], (u64)(array.Count()));
+}
+
+/// NOTE: replaces the contents of 'vector' with what alt::Save() wrote to 'file'.  Raw elements are read straight into
+/// the Vector's buffer, which is sized once from the header.
+/// RTRN: true if the header doesn't match, the elements don't fit, or any read fails, in which case 'vector' may hold
+/// a partially loaded prefix
+template <typename Datatype, class... Policies>
+bool Load(const i32 file, Vector<Datatype, Policies...>& vector)
+{
+	vector.Erase();
+	return _LoadElements<Datatype>(file, [&vector](const u64 count) -> Datatype*
+	{
+		if (count > GROWTH_MAXIMUM_CAPACITY || vector.Extend((u32)(count)))
+			return nullptr;
+		return vector.Data();
+	});
+}
+
+template <typename Datatype, i64 Capacity>
+bool Load(const i32 file, Array<Datatype, Capacity>& array)
+{
+	array.Erase();
+	return _LoadElements<Datatype>(file, [&array](const u64 count) -> Datatype*
+	{
+		if (count > (u64)(Capacity) || array.Extend((i64)(count)))
+			return nullptr;
+		return &array[0];
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end SERIALIZE_HPP
@@ -0,0 +1,273 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef SLOTMAP_HPP
+#define SLOTMAP_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Vector.hpp"
+#include "Index.hpp"
+
+namespace alt // SlotMap belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: SlotMap keeps its values densely packed in a Vector, so iterating over Data() is a plain array walk, & hands
+/// out alt::Index handles which stay valid while their value moves around inside that Vector.  A handle's low 32
+/// bits name a slot, which records where its value currently lives, & its high bits hold the slot's generation.
+/// Erasing a value bumps its slot's generation & pushes the slot onto a free list, so every old handle to that slot
+/// stops matching, even after the slot is reused.  Insert, Erase, & lookup are all O(1).
+///
+/// NOTE: generations stay below 2^31 so a handle is never negative & never collides with the invalid Index -1.  A
+/// slot whose generation runs out is retired instead of reused.
+template <typename Datatype>
+class SlotMap
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+private:
+
+READONLY u32 NONE           = 0xFFFFFFFF;
+READONLY u32 MAX_GENERATION = 0x7FFFFFFF;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SLOT
+private:
+
+class _Slot
+{
+public:
+	u32 _Dense;         // The position of the slot's value in _Values, or the next free slot while it's free
+	u32 _Generation;    // The number of times the slot's value has been erased
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	Vector<Datatype> _Values;   // The values, densely packed
+	Vector<u32>      _Owners;   // The slot of each value in _Values
+	Vector<_Slot>    _Slots;    // The indirection from a handle to its value
+	u32              _Free;     // The first slot of the free list
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONSTRUCTORS
+public:
+
+SlotMap() noexcept:
+	_Values(),
+	_Owners(),
+	_Slots(),
+	_Free(NONE)
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE ACCESSORS
+public:
+
+u32 Size(void) const noexcept
+{
+	return _Values.Size();
+}
+
+bool Empty(void) const noexcept
+{
+	return _Values.Empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+bool Contains(const Index& handle) const noexcept
+{
+	return _Lookup(handle) != NONE;
+}
+
+/// NOTE: returns nullptr if 'handle' is invalid or stale
+const Datatype* Find(const Index& handle) const noexcept
+{
+	const u32 dense = _Lookup(handle);
+	return dense == NONE ? nullptr : &_Values[dense];
+}
+
+Datatype* Find(const Index& handle) noexcept
+{
+	const u32 dense = _Lookup(handle);
+	return dense == NONE ? nullptr : &_Values[dense];
+}
+
+const Datatype& At(const Index& handle) const
+{
+	const Datatype* const value = Find(handle);
+	if (! value)
+		throw alt::InvalidIndex();
+	return *value;
+}
+
+Datatype& At(const Index& handle)
+{
+	Datatype* const value = Find(handle);
+	if (! value)
+		throw alt::InvalidIndex();
+	return *value;
+}
+
+/// WARN: 'handle' must be live
+const Datatype& operator [] (const Index& handle) const noexcept
+{
+	return _Values[_Slots[_SlotOf(handle)]._Dense];
+}
+
+/// WARN: 'handle' must be live
+Datatype& operator [] (const Index& handle) noexcept
+{
+	return _Values[_Slots[_SlotOf(handle)]._Dense];
+}
+
+/// NOTE: the values in their dense order, which changes whenever a value is erased
+const Datatype* Data(void) const noexcept
+{
+	return _Values.Data();
+}
+
+Datatype* Data(void) noexcept
+{
+	return _Values.Data();
+}
+
+/// NOTE: the handle of the value at 'dense' in Data(), or the invalid Index -1 if 'dense' is out of bounds
+Index HandleAt(const u32 dense) const noexcept
+{
+	if (dense >= _Values.Size())
+		return Index { -1 };
+	const u32 slot = _Owners[dense];
+	return _Handle(slot, _Slots[slot]._Generation);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: returns the invalid Index -1 if the SlotMap is full
+Index Insert(const Datatype& x)
+{
+	const bool fresh = _Free == NONE;
+	const u32  slot  = fresh ? _Slots.Size() : _Free;
+	if (fresh && _Slots.PushBack(_Slot { NONE, 0 }))
+		return Index { -1 };
+	bool failed = _Owners.PushBack(slot);
+	if (! failed && _Values.PushBack(x))
+	{
+		u32 discard;
+		_Owners.PopBack(discard);
+		failed = true;
+	}
+	if (failed)
+	{
+		if (fresh)
+			_Release(slot);
+		return Index { -1 };
+	}
+	if (! fresh)
+		_Free = _Slots[slot]._Dense;
+	_Slots[slot]._Dense = _Values.Size() - 1;
+	return _Handle(slot, _Slots[slot]._Generation);
+}
+
+/// NOTE: the last value is moved into the erased value's place
+/// RTRN: true if 'handle' is invalid or stale
+bool Erase(const Index& handle) noexcept
+{
+	const u32 dense = _Lookup(handle);
+	if (dense == NONE)
+		return true;
+	const u32 slot = _Owners[dense];
+	const u32 last = _Owners[_Owners.Size() - 1];
+	_Values.SwapRemove(dense);
+	_Owners.SwapRemove(dense);
+	_Slots[last]._Dense = dense;
+	_Retire(slot);
+	return false;
+}
+
+/// NOTE: erases every value, every outstanding handle goes stale
+void Erase(void) noexcept
+{
+	for (u32 i = 0; i < _Owners.Size(); i++)
+		_Retire(_Owners[i]);
+	_Values.Erase();
+	_Owners.Erase();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// HANDLE HELPER METHODS
+private:
+
+static Index _Handle(const u32 slot, const u32 generation) noexcept
+{
+	return Index { (i64)(((u64)(generation) << 32) | slot) };
+}
+
+static u32 _SlotOf(const Index& handle) noexcept
+{
+	return (u32)(handle.Value());
+}
+
+/// NOTE: the position of the value 'handle' refers to, or NONE if it's invalid or stale
+u32 _Lookup(const Index& handle) const noexcept
+{
+	const u64 value = handle.Value();
+	const u32 slot  = (u32)(value);
+	if (! handle.Valid() ||
+		slot >= _Slots.Size() ||
+		_Slots[slot]._Generation != (u32)(value >> 32) ||
+		_Slots[slot]._Dense == NONE)
+		return NONE;
+	return _Slots[slot]._Dense;
+}
+
+/// NOTE: bumps the generation of a slot whose value was erased & frees it, unless its generation has run out
+void _Retire(const u32 slot) noexcept
+{
+	_Slots[slot]._Dense = NONE;
+	if (_Slots[slot]._Generation == MAX_GENERATION)
+		return;
+	_Slots[slot]._Generation++;
+	_Release(slot);
+}
+
+void _Release(const u32 slot) noexcept
+{
+	_Slots[slot]._Dense = _Free;
+	_Free = slot;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end SLOTMAP_HPP
@@ -0,0 +1,419 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef SOAVECTOR_HPP
+#define SOAVECTOR_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+
+#include <cstring>     // exclusively for std::memcpy()
+#include <new>         // exclusively for std::align_val_t & std::nothrow
+#include <type_traits> // exclusively for std::is_trivially_copyable
+#include <utility>     // exclusively for std::index_sequence
+
+namespace alt // SoAVector belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: resolves to the type of field number 'Field' of 'Fields'
+template <uSIZE Field, typename First, typename... Rest>
+class _SoAFieldType
+{
+public:
+	typedef typename _SoAFieldType<Field - 1, Rest...>::Type Type;
+};
+
+template <typename First, typename... Rest>
+class _SoAFieldType<0, First, Rest...>
+{
+public:
+	typedef First Type;
+};
+
+/// NOTE: SoAVector is a structure-of-arrays vector.  Each field of a row lives in its own contiguous column aligned to
+/// COLUMN_ALIGNMENT bytes, and every column grows together, so a loop over one field streams only that field through
+/// the cache and vectorizes like a loop over a plain array.  Rows are reached through the Row & ConstRow proxies.
+///
+/// WARN: every field must be trivially copyable, columns are grown & copied with std::memcpy().
+template <typename... Fields>
+class SoAVector
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS & TYPES
+public:
+
+static_assert(sizeof...(Fields) > 0, "alt::SoAVector requires at least one field");
+static_assert((std::is_trivially_copyable<Fields>::value && ...), "alt::SoAVector fields must be trivially copyable");
+
+READONLY uSIZE FIELD_COUNT      = sizeof...(Fields);
+READONLY uSIZE COLUMN_ALIGNMENT = 64;
+READONLY uSIZE FIELD_SIZES[]    = { sizeof(Fields)... };
+
+template <uSIZE Field>
+using FieldType = typename _SoAFieldType<Field, Fields...>::Type;
+
+class Row;
+class ConstRow;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	u32   _Count;                   // The number of rows in the SoAVector
+	u32   _Length;                  // The number of rows every column can hold before a growth event
+	void* _Columns[FIELD_COUNT];    // One aligned array per field
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR & DESTRUCTOR
+public:
+
+SoAVector() noexcept:
+	_Count(0),
+	_Length(0),
+	_Columns{nullptr}
+{}
+
+~SoAVector() noexcept
+{
+	_Free();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// OVERLOADED CONSTRUCTORS
+public:
+
+explicit SoAVector(const u32 initLength):
+	_Count(0),
+	_Length(0),
+	_Columns{nullptr}
+{
+	if (initLength)
+		_Grow(initLength);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COPY CONSTRUCTOR, MOVE CONSTRUCTOR, & ASSIGNMENT OPERATOR
+public:
+
+SoAVector(const SoAVector& copy):
+	_Count(0),
+	_Length(0),
+	_Columns{nullptr}
+{
+	_CopyFrom(copy);
+}
+
+SoAVector(SoAVector&& move) noexcept:
+	_Count(move._Count),
+	_Length(move._Length),
+	_Columns{nullptr}
+{
+	for (uSIZE f = 0; f < FIELD_COUNT; f++)
+	{
+		_Columns[f]      = move._Columns[f];
+		move._Columns[f] = nullptr;
+	}
+	move._Count  = 0;
+	move._Length = 0;
+}
+
+SoAVector& operator = (const SoAVector& copy)
+{
+	if (this != &copy)
+	{
+		this->_Count = 0;
+		this->_CopyFrom(copy);
+	}
+	return *this;
+}
+
+SoAVector& operator = (SoAVector&& move) noexcept
+{
+	if (this != &move)
+	{
+		this->_Free();
+		for (uSIZE f = 0; f < FIELD_COUNT; f++)
+		{
+			this->_Columns[f] = move._Columns[f];
+			move._Columns[f]  = nullptr;
+		}
+		this->_Count  = move._Count;
+		this->_Length = move._Length;
+		move._Count   = 0;
+		move._Length  = 0;
+	}
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+u32 Size(void) const noexcept
+{
+	return _Count;
+}
+
+u32 Capacity(void) const noexcept
+{
+	return _Length;
+}
+
+bool Empty(void) const noexcept
+{
+	return _Count == 0;
+}
+
+bool Full(void) const noexcept
+{
+	return _Count == _Length;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY MODIFIERS
+public:
+
+/// NOTE: returns true if every column can already hold 'newCapacity' rows
+bool Reserve(const u32 newCapacity)
+{
+	if (newCapacity <= _Length)
+		return true;
+	_Grow(newCapacity);
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COLUMN ACCESSORS
+public:
+
+/// NOTE: the contiguous, COLUMN_ALIGNMENT aligned array of field 'Field', holding Size() elements
+template <uSIZE Field>
+const FieldType<Field>* Column(void) const noexcept
+{
+	return (const FieldType<Field>*)(_Columns[Field]);
+}
+
+template <uSIZE Field>
+FieldType<Field>* Column(void) noexcept
+{
+	return (FieldType<Field>*)(_Columns[Field]);
+}
+
+template <uSIZE Field>
+const FieldType<Field>& At(const u32 row) const
+{
+	if (row >= _Count)
+		throw alt::InvalidIndex();
+	return Column<Field>()[row];
+}
+
+template <uSIZE Field>
+FieldType<Field>& At(const u32 row)
+{
+	if (row >= _Count)
+		throw alt::InvalidIndex();
+	return Column<Field>()[row];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// ROW ACCESSORS
+public:
+
+ConstRow operator [] (const u32 row) const noexcept
+{
+	return ConstRow { this, row };
+}
+
+Row operator [] (const u32 row) noexcept
+{
+	return Row { this, row };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+bool PushBack(const Fields&... values)
+{
+	if (_Count == 0xFFFFFFFFu)
+		return true;
+	if (Full())
+		_Grow(_Length ? (_Length > 0x7FFFFFFFu ? 0xFFFFFFFFu : _Length * 2) : 1);
+	_Store(_Count, std::index_sequence_for<Fields...> {}, values...);
+	_Count++;
+	return false;
+}
+
+bool PopBack(void) noexcept
+{
+	if (Empty())
+		return true;
+	_Count--;
+	return false;
+}
+
+/// NOTE: O(1), the last row is moved into 'row' so the order of the SoAVector is not preserved
+bool SwapRemove(const u32 row) noexcept
+{
+	if (row >= _Count)
+		return true;
+	_Count--;
+	if (row != _Count)
+		for (uSIZE f = 0; f < FIELD_COUNT; f++)
+			std::memcpy((u8*)(_Columns[f]) + FIELD_SIZES[f] * row,
+			            (u8*)(_Columns[f]) + FIELD_SIZES[f] * _Count,
+			            FIELD_SIZES[f]);
+	return false;
+}
+
+void Erase(void) noexcept
+{
+	_Count = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// ROW PROXIES
+public:
+
+class Row final
+{
+private:
+
+	SoAVector* const _Owner;
+	const u32        _Index;
+
+public:
+
+	Row(SoAVector* const owner, const u32 index) noexcept:
+		_Owner(owner),
+		_Index(index)
+	{}
+
+	u32 Index(void) const noexcept
+	{
+		return _Index;
+	}
+
+	template <uSIZE Field>
+	FieldType<Field>& Get(void) const noexcept
+	{
+		return _Owner->template Column<Field>()[_Index];
+	}
+
+	void Set(const Fields&... values) const noexcept
+	{
+		_Owner->_Store(_Index, std::index_sequence_for<Fields...> {}, values...);
+	}
+};
+
+class ConstRow final
+{
+private:
+
+	const SoAVector* const _Owner;
+	const u32              _Index;
+
+public:
+
+	ConstRow(const SoAVector* const owner, const u32 index) noexcept:
+		_Owner(owner),
+		_Index(index)
+	{}
+
+	u32 Index(void) const noexcept
+	{
+		return _Index;
+	}
+
+	template <uSIZE Field>
+	const FieldType<Field>& Get(void) const noexcept
+	{
+		return _Owner->template Column<Field>()[_Index];
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// COLUMN HELPER METHODS
+private:
+
+template <uSIZE... Field>
+void _Store(const u32 row, std::index_sequence<Field...>, const Fields&... values) noexcept
+{
+	((Column<Field>()[row] = values), ...);
+}
+
+/// NOTE: reallocates every column to hold 'newLength' rows, nothing is changed if any allocation fails
+void _Grow(const u32 newLength)
+{
+	void* fresh[FIELD_COUNT] = {nullptr};
+	for (uSIZE f = 0; f < FIELD_COUNT; f++)
+	{
+		fresh[f] = ::operator new(FIELD_SIZES[f] * newLength, std::align_val_t(COLUMN_ALIGNMENT), std::nothrow);
+		if (fresh[f] == nullptr)
+		{
+			for (uSIZE g = 0; g < f; g++)
+				::operator delete(fresh[g], std::align_val_t(COLUMN_ALIGNMENT));
+			throw alt::MallocFailure {};
+		}
+	}
+	for (uSIZE f = 0; f < FIELD_COUNT; f++)
+	{
+		if (_Count)
+			std::memcpy(fresh[f], _Columns[f], FIELD_SIZES[f] * _Count);
+		if (_Columns[f])
+			::operator delete(_Columns[f], std::align_val_t(COLUMN_ALIGNMENT));
+		_Columns[f] = fresh[f];
+	}
+	_Length = newLength;
+}
+
+void _Free(void) noexcept
+{
+	for (uSIZE f = 0; f < FIELD_COUNT; f++)
+		if (_Columns[f])
+		{
+			::operator delete(_Columns[f], std::align_val_t(COLUMN_ALIGNMENT));
+			_Columns[f] = nullptr;
+		}
+	_Count  = 0;
+	_Length = 0;
+}
+
+void _CopyFrom(const SoAVector& copy)
+{
+	if (_Length < copy._Count)
+		_Grow(copy._Count);
+	for (uSIZE f = 0; f < FIELD_COUNT; f++)
+		if (copy._Count)
+			std::memcpy(_Columns[f], copy._Columns[f], FIELD_SIZES[f] * copy._Count);
+	_Count = copy._Count;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end SOAVECTOR_HPP
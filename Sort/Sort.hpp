@@ -0,0 +1,699 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef SORT_HPP
+#define SORT_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Allocator.hpp"
+
+#include <cstring>     // exclusively for std::memcpy()
+#include <type_traits> // exclusively for std::is_integral, std::is_signed, std::is_arithmetic, & std::is_same
+
+namespace alt // Sort belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SORT TUNING CONSTANTS
+
+READONLY i64 SORT_NETWORK_THRESHOLD   = 8;   // partitions this small are finished by a sorting network
+READONLY i64 SORT_INSERTION_THRESHOLD = 24;  // partitions smaller than this are finished by insertion sort
+READONLY i64 SORT_NINTHER_THRESHOLD   = 128; // partitions larger than this pick their pivot by Tukey's ninther
+READONLY i64 SORT_PARTIAL_LIMIT       = 8;   // element moves a partial insertion sort may make before giving up
+READONLY i64 SORT_MERGE_RUN           = 32;  // run length insertion sorted by StableSort() before merging
+READONLY i64 SORT_RADIX_THRESHOLD     = 256; // element count at which Sort() prefers RadixSort()
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// COMPARATORS
+
+template <typename Datatype>
+class Less final
+{
+public:
+
+constexpr bool operator () (const Datatype& lhs, const Datatype& rhs) const
+{
+	return lhs < rhs;
+}
+
+};
+
+template <typename Datatype>
+class Greater final
+{
+public:
+
+constexpr bool operator () (const Datatype& lhs, const Datatype& rhs) const
+{
+	return rhs < lhs;
+}
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RADIX KEYS
+
+/// NOTE: RadixKey maps a Datatype onto an unsigned integer whose byte-wise order matches operator <, and hands out
+/// that integer one byte at a time.  Any Datatype with an enabled RadixKey is radix sorted by alt::Sort() and
+/// alt::StableSort() when no comparator is given.  Specialize it to opt a new key type in.
+template <typename Datatype, typename Enable = void>
+class RadixKey
+{
+public:
+
+READONLY bool Enabled = false;
+READONLY u32  Bytes   = 0;
+
+static u8 Digit(const Datatype& x, const u32 byte) noexcept
+{
+	return 0;
+}
+
+};
+
+/// NOTE: signed integers have their sign bit flipped so that negative keys order before positive keys
+template <typename Datatype>
+class RadixKey<Datatype, typename std::enable_if<std::is_integral<Datatype>::value &&
+                                                 ! std::is_same<Datatype, bool>::value>::type>
+{
+public:
+
+READONLY bool Enabled = true;
+READONLY u32  Bytes   = sizeof(Datatype);
+
+static u8 Digit(const Datatype& x, const u32 byte) noexcept
+{
+	u64 bits = (u64)(x);
+	if (std::is_signed<Datatype>::value)
+		bits ^= (u64)(1) << (Bytes * 8 - 1);
+	return (u8)(bits >> (byte * 8));
+}
+
+};
+
+/// NOTE: negative floats have every bit flipped, positive floats only their sign bit, which orders -inf < ... < +inf
+/// with NaNs at either extreme depending on their sign bit
+template <>
+class RadixKey<f32>
+{
+public:
+
+READONLY bool Enabled = true;
+READONLY u32  Bytes   = sizeof(f32);
+
+static u8 Digit(const f32& x, const u32 byte) noexcept
+{
+	u32 bits;
+	std::memcpy(&bits, &x, sizeof(bits));
+	bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+	return (u8)(bits >> (byte * 8));
+}
+
+};
+
+template <>
+class RadixKey<f64>
+{
+public:
+
+READONLY bool Enabled = true;
+READONLY u32  Bytes   = sizeof(f64);
+
+static u8 Digit(const f64& x, const u32 byte) noexcept
+{
+	u64 bits;
+	std::memcpy(&bits, &x, sizeof(bits));
+	bits = (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+	return (u8)(bits >> (byte * 8));
+}
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SORT HELPER FUNCTIONS
+
+/// NOTE: returns floor(log2(x)) for x > 0
+inline i64 _SortLog2(i64 x) noexcept
+{
+	i64 log = 0;
+	while (x >>= 1)
+		log++;
+	return log;
+}
+
+template <typename Datatype>
+constexpr void _SortSwap(Datatype* const ptr1st, Datatype* const ptr2nd)
+{
+	Datatype tmp = (Datatype&&)(*ptr1st);
+	*ptr1st      = (Datatype&&)(*ptr2nd);
+	*ptr2nd      = (Datatype&&)(tmp);
+}
+
+/// NOTE: arithmetic types are exchanged with conditional moves rather than a branch
+template <typename Datatype, class Compare>
+void _CompareSwap(Datatype* const ptr1st, Datatype* const ptr2nd, Compare& less)
+{
+	if constexpr (std::is_arithmetic<Datatype>::value)
+	{
+		const Datatype x = *ptr1st;
+		const Datatype y = *ptr2nd;
+		const bool swap  = less(y, x);
+		*ptr1st = swap ? y : x;
+		*ptr2nd = swap ? x : y;
+	}
+	else if (less(*ptr2nd, *ptr1st))
+		_SortSwap(ptr1st, ptr2nd);
+}
+
+template <typename Datatype, class Compare>
+void _Sort3(Datatype* const a, Datatype* const b, Datatype* const c, Compare& less)
+{
+	_CompareSwap(a, b, less);
+	_CompareSwap(b, c, less);
+	_CompareSwap(a, b, less);
+}
+
+/// NOTE: optimal-depth sorting networks for 2 to 8 elements
+template <typename Datatype, class Compare>
+void _NetworkSort(Datatype* const p, const i64 count, Compare& less)
+{
+	switch (count)
+	{
+	case 2:
+		_CompareSwap(p + 0, p + 1, less);
+		break;
+	case 3:
+		_CompareSwap(p + 0, p + 2, less); _CompareSwap(p + 0, p + 1, less); _CompareSwap(p + 1, p + 2, less);
+		break;
+	case 4:
+		_CompareSwap(p + 0, p + 2, less); _CompareSwap(p + 1, p + 3, less); _CompareSwap(p + 0, p + 1, less);
+		_CompareSwap(p + 2, p + 3, less); _CompareSwap(p + 1, p + 2, less);
+		break;
+	case 5:
+		_CompareSwap(p + 0, p + 3, less); _CompareSwap(p + 1, p + 4, less); _CompareSwap(p + 0, p + 2, less);
+		_CompareSwap(p + 1, p + 3, less); _CompareSwap(p + 0, p + 1, less); _CompareSwap(p + 2, p + 4, less);
+		_CompareSwap(p + 1, p + 2, less); _CompareSwap(p + 3, p + 4, less); _CompareSwap(p + 2, p + 3, less);
+		break;
+	case 6:
+		_CompareSwap(p + 0, p + 5, less); _CompareSwap(p + 1, p + 3, less); _CompareSwap(p + 2, p + 4, less);
+		_CompareSwap(p + 1, p + 2, less); _CompareSwap(p + 3, p + 4, less); _CompareSwap(p + 0, p + 3, less);
+		_CompareSwap(p + 2, p + 5, less); _CompareSwap(p + 0, p + 1, less); _CompareSwap(p + 2, p + 3, less);
+		_CompareSwap(p + 4, p + 5, less); _CompareSwap(p + 1, p + 2, less); _CompareSwap(p + 3, p + 4, less);
+		break;
+	case 7:
+		_CompareSwap(p + 0, p + 6, less); _CompareSwap(p + 2, p + 3, less); _CompareSwap(p + 4, p + 5, less);
+		_CompareSwap(p + 0, p + 2, less); _CompareSwap(p + 1, p + 4, less); _CompareSwap(p + 3, p + 6, less);
+		_CompareSwap(p + 0, p + 1, less); _CompareSwap(p + 2, p + 5, less); _CompareSwap(p + 3, p + 4, less);
+		_CompareSwap(p + 1, p + 2, less); _CompareSwap(p + 4, p + 6, less); _CompareSwap(p + 2, p + 3, less);
+		_CompareSwap(p + 4, p + 5, less); _CompareSwap(p + 1, p + 2, less); _CompareSwap(p + 3, p + 4, less);
+		_CompareSwap(p + 5, p + 6, less);
+		break;
+	case 8:
+		_CompareSwap(p + 0, p + 2, less); _CompareSwap(p + 1, p + 3, less); _CompareSwap(p + 4, p + 6, less);
+		_CompareSwap(p + 5, p + 7, less); _CompareSwap(p + 0, p + 4, less); _CompareSwap(p + 1, p + 5, less);
+		_CompareSwap(p + 2, p + 6, less); _CompareSwap(p + 3, p + 7, less); _CompareSwap(p + 0, p + 1, less);
+		_CompareSwap(p + 2, p + 3, less); _CompareSwap(p + 4, p + 5, less); _CompareSwap(p + 6, p + 7, less);
+		_CompareSwap(p + 2, p + 4, less); _CompareSwap(p + 3, p + 5, less); _CompareSwap(p + 1, p + 4, less);
+		_CompareSwap(p + 3, p + 6, less); _CompareSwap(p + 1, p + 2, less); _CompareSwap(p + 3, p + 4, less);
+		_CompareSwap(p + 5, p + 6, less);
+		break;
+	default:
+		break;
+	}
+}
+
+template <typename Datatype, class Compare>
+void _InsertionSort(Datatype* const begin, Datatype* const end, Compare& less)
+{
+	if (begin == end)
+		return;
+	for (Datatype* cur = begin + 1; cur < end; cur++)
+	{
+		Datatype* sift    = cur;
+		Datatype* sift1st = cur - 1;
+		if (less(*sift, *sift1st))
+		{
+			Datatype tmp = (Datatype&&)(*sift);
+			do
+				*sift-- = (Datatype&&)(*sift1st);
+			while (sift != begin && less(tmp, *--sift1st));
+			*sift = (Datatype&&)(tmp);
+		}
+	}
+}
+
+/// WARN: requires *(begin - 1) to compare less than or equal to every element in [begin, end)
+template <typename Datatype, class Compare>
+void _UnguardedInsertionSort(Datatype* const begin, Datatype* const end, Compare& less)
+{
+	if (begin == end)
+		return;
+	for (Datatype* cur = begin + 1; cur < end; cur++)
+	{
+		Datatype* sift    = cur;
+		Datatype* sift1st = cur - 1;
+		if (less(*sift, *sift1st))
+		{
+			Datatype tmp = (Datatype&&)(*sift);
+			do
+				*sift-- = (Datatype&&)(*sift1st);
+			while (less(tmp, *--sift1st));
+			*sift = (Datatype&&)(tmp);
+		}
+	}
+}
+
+/// NOTE: returns false as soon as more than SORT_PARTIAL_LIMIT elements have been moved, leaving [begin, end) permuted
+/// but not sorted
+template <typename Datatype, class Compare>
+bool _PartialInsertionSort(Datatype* const begin, Datatype* const end, Compare& less)
+{
+	if (begin == end)
+		return true;
+	i64 moved = 0;
+	for (Datatype* cur = begin + 1; cur < end; cur++)
+	{
+		Datatype* sift    = cur;
+		Datatype* sift1st = cur - 1;
+		if (less(*sift, *sift1st))
+		{
+			Datatype tmp = (Datatype&&)(*sift);
+			do
+				*sift-- = (Datatype&&)(*sift1st);
+			while (sift != begin && less(tmp, *--sift1st));
+			*sift = (Datatype&&)(tmp);
+			moved += cur - sift;
+		}
+		if (moved > SORT_PARTIAL_LIMIT)
+			return false;
+	}
+	return true;
+}
+
+template <typename Datatype, class Compare>
+constexpr void _SiftDown(Datatype* const base, i64 root, const i64 count, Compare& less)
+{
+	Datatype tmp = (Datatype&&)(base[root]);
+	for (i64 child = 2 * root + 1; child < count; child = 2 * root + 1)
+	{
+		if (child + 1 < count && less(base[child], base[child + 1]))
+			child++;
+		if (! less(tmp, base[child]))
+			break;
+		base[root] = (Datatype&&)(base[child]);
+		root = child;
+	}
+	base[root] = (Datatype&&)(tmp);
+}
+
+template <typename Datatype, class Compare>
+constexpr void _HeapSort(Datatype* const begin, Datatype* const end, Compare& less)
+{
+	const i64 count = end - begin;
+	for (i64 i = count / 2 - 1; i >= 0; i--)
+		_SiftDown(begin, i, count, less);
+	for (i64 i = count - 1; i > 0; i--)
+	{
+		_SortSwap(begin, begin + i);
+		_SiftDown(begin, 0, i, less);
+	}
+}
+
+/// NOTE: partitions [begin, end) around the pivot *begin, placing elements equal to the pivot in the right partition
+/// RTRN: the final position of the pivot, and whether the range was already partitioned through 'partitioned'
+template <typename Datatype, class Compare>
+Datatype* _PartitionRight(Datatype* const begin, Datatype* const end, Compare& less, bool& partitioned)
+{
+	Datatype pivot = (Datatype&&)(*begin);
+	Datatype* first = begin;
+	Datatype* last  = end;
+	while (less(*++first, pivot));
+	if (first - 1 == begin)
+		while (first < last && ! less(*--last, pivot));
+	else
+		while (! less(*--last, pivot));
+	partitioned = first >= last;
+	while (first < last)
+	{
+		_SortSwap(first, last);
+		while (less(*++first, pivot));
+		while (! less(*--last, pivot));
+	}
+	Datatype* const pivotPos = first - 1;
+	*begin    = (Datatype&&)(*pivotPos);
+	*pivotPos = (Datatype&&)(pivot);
+	return pivotPos;
+}
+
+/// NOTE: partitions [begin, end) around the pivot *begin, placing elements equal to the pivot in the left partition;
+/// used when the pivot equals its left neighbour, which collapses runs of equal keys in a single pass
+template <typename Datatype, class Compare>
+Datatype* _PartitionLeft(Datatype* const begin, Datatype* const end, Compare& less)
+{
+	Datatype pivot = (Datatype&&)(*begin);
+	Datatype* first = begin;
+	Datatype* last  = end;
+	while (less(pivot, *--last));
+	if (last + 1 == end)
+		while (first < last && ! less(pivot, *++first));
+	else
+		while (! less(pivot, *++first));
+	while (first < last)
+	{
+		_SortSwap(first, last);
+		while (less(pivot, *--last));
+		while (! less(pivot, *++first));
+	}
+	Datatype* const pivotPos = last;
+	*begin    = (Datatype&&)(*pivotPos);
+	*pivotPos = (Datatype&&)(pivot);
+	return pivotPos;
+}
+
+/// NOTE: pattern-defeating quicksort (Orson Peters); 'badAllowed' is the number of highly unbalanced partitions
+/// tolerated before the range falls back to heapsort, and 'leftmost' is false whenever *(begin - 1) is a valid sentinel
+template <typename Datatype, class Compare>
+void _PdqSort(Datatype* begin, Datatype* const end, Compare& less, i64 badAllowed, bool leftmost)
+{
+	for (;;)
+	{
+		const i64 count = end - begin;
+		if (count < SORT_INSERTION_THRESHOLD)
+		{
+			if (count <= SORT_NETWORK_THRESHOLD)
+				_NetworkSort(begin, count, less);
+			else if (leftmost)
+				_InsertionSort(begin, end, less);
+			else
+				_UnguardedInsertionSort(begin, end, less);
+			return;
+		}
+
+		const i64 half = count / 2;
+		if (count > SORT_NINTHER_THRESHOLD)
+		{
+			_Sort3(begin,            begin + half,       end - 1, less);
+			_Sort3(begin + 1,        begin + (half - 1), end - 2, less);
+			_Sort3(begin + 2,        begin + (half + 1), end - 3, less);
+			_Sort3(begin + (half - 1), begin + half,     begin + (half + 1), less);
+			_SortSwap(begin, begin + half);
+		}
+		else
+			_Sort3(begin + half, begin, end - 1, less);
+
+		if (! leftmost && ! less(*(begin - 1), *begin))
+		{
+			begin = _PartitionLeft(begin, end, less) + 1;
+			continue;
+		}
+
+		bool partitioned = false;
+		Datatype* const pivotPos = _PartitionRight(begin, end, less, partitioned);
+
+		const i64 countL = pivotPos - begin;
+		const i64 countR = end - (pivotPos + 1);
+		if (countL < count / 8 || countR < count / 8)
+		{
+			if (--badAllowed == 0)
+			{
+				_HeapSort(begin, end, less);
+				return;
+			}
+			if (countL >= SORT_INSERTION_THRESHOLD)
+			{
+				_SortSwap(begin,        begin + countL / 4);
+				_SortSwap(pivotPos - 1, pivotPos - countL / 4);
+				if (countL > SORT_NINTHER_THRESHOLD)
+				{
+					_SortSwap(begin + 1,    begin + (countL / 4 + 1));
+					_SortSwap(begin + 2,    begin + (countL / 4 + 2));
+					_SortSwap(pivotPos - 2, pivotPos - (countL / 4 + 1));
+					_SortSwap(pivotPos - 3, pivotPos - (countL / 4 + 2));
+				}
+			}
+			if (countR >= SORT_INSERTION_THRESHOLD)
+			{
+				_SortSwap(pivotPos + 1, pivotPos + (1 + countR / 4));
+				_SortSwap(end - 1,      end - countR / 4);
+				if (countR > SORT_NINTHER_THRESHOLD)
+				{
+					_SortSwap(pivotPos + 2, pivotPos + (2 + countR / 4));
+					_SortSwap(pivotPos + 3, pivotPos + (3 + countR / 4));
+					_SortSwap(end - 2,      end - (1 + countR / 4));
+					_SortSwap(end - 3,      end - (2 + countR / 4));
+				}
+			}
+		}
+		else if (partitioned &&
+				 _PartialInsertionSort(begin, pivotPos, less) &&
+				 _PartialInsertionSort(pivotPos + 1, end, less))
+			return;
+
+		_PdqSort(begin, pivotPos, less, badAllowed, leftmost);
+		begin    = pivotPos + 1;
+		leftmost = false;
+	}
+}
+
+/// NOTE: sorts [begin, end) in O(n) if it is already non-descending or strictly descending (reversing a strictly
+/// descending range is stable), and otherwise returns false having only compared a prefix of the range
+template <typename Datatype, class Compare>
+bool _SortRun(Datatype* const begin, Datatype* const end, Compare& less)
+{
+	Datatype* ptr = begin + 1;
+	while (ptr < end && ! less(*ptr, *(ptr - 1)))
+		ptr++;
+	if (ptr == end)
+		return true;
+	if (ptr != begin + 1)
+		return false;
+	while (ptr < end && less(*ptr, *(ptr - 1)))
+		ptr++;
+	if (ptr != end)
+		return false;
+	for (Datatype *lo = begin, *hi = end - 1; lo < hi; lo++, hi--)
+		_SortSwap(lo, hi);
+	return true;
+}
+
+template <typename Datatype, class Compare>
+void _Merge(Datatype* lhs, Datatype* const mid, Datatype* const end, Datatype* out, Compare& less)
+{
+	Datatype* rhs = mid;
+	while (lhs < mid && rhs < end)
+		*out++ = less(*rhs, *lhs) ? (Datatype&&)(*rhs++) : (Datatype&&)(*lhs++);
+	while (lhs < mid)
+		*out++ = (Datatype&&)(*lhs++);
+	while (rhs < end)
+		*out++ = (Datatype&&)(*rhs++);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SORT FUNCTIONS
+
+template <typename Datatype, class Compare>
+constexpr bool IsSorted(const Datatype* const base, const i64 count, Compare less)
+{
+	for (i64 i = 1; i < count; i++)
+		if (less(base[i], base[i - 1]))
+			return false;
+	return true;
+}
+
+template <typename Datatype>
+constexpr bool IsSorted(const Datatype* const base, const i64 count)
+{
+	return IsSorted(base, count, alt::Less<Datatype> {});
+}
+
+/// NOTE: unstable, in place, O(n log n) worst case, & unlike Sort() usable in constant expressions, so it's the sort
+/// for tables built at compile time
+template <typename Datatype, class Compare>
+constexpr void HeapSort(Datatype* const base, const i64 count, Compare less)
+{
+	if (base == nullptr || count < 2)
+		return;
+	_HeapSort(base, base + count, less);
+}
+
+template <typename Datatype>
+constexpr void HeapSort(Datatype* const base, const i64 count)
+{
+	HeapSort(base, count, alt::Less<Datatype> {});
+}
+
+/// NOTE: branchless binary search, the loop carries no data-dependent branch so it never mispredicts
+/// RTRN: the index of the first element of the sorted range [base, base + count) which is not less than 'key'
+template <typename Datatype, class Compare>
+i64 LowerBound(const Datatype* const base, const i64 count, const Datatype& key, Compare less)
+{
+	if (count <= 0)
+		return 0;
+	const Datatype* ptr = base;
+	for (i64 n = count; n > 1; )
+	{
+		const i64 half = n / 2;
+		ptr = less(ptr[half - 1], key) ? ptr + half : ptr;
+		n -= half;
+	}
+	return (ptr - base) + less(*ptr, key);
+}
+
+template <typename Datatype>
+i64 LowerBound(const Datatype* const base, const i64 count, const Datatype& key)
+{
+	return LowerBound(base, count, key, alt::Less<Datatype> {});
+}
+
+/// NOTE: unstable, in place, O(n log n) worst case; 'less' must be a strict weak ordering
+template <typename Datatype, class Compare>
+void Sort(Datatype* const base, const i64 count, Compare less)
+{
+	if (base == nullptr || count < 2)
+		return;
+	_PdqSort(base, base + count, less, _SortLog2(count), true);
+}
+
+/// NOTE: stable LSD radix sort over RadixKey<Datatype>, one pass per key byte, skipping bytes every key shares
+/// RTRN: true if the scratch buffer could not be allocated or 'count' exceeds u32, in which case nothing is moved
+template <typename Datatype>
+bool RadixSort(Datatype* const base, const i64 count)
+{
+	static_assert(RadixKey<Datatype>::Enabled, "alt::RadixSort() requires an enabled alt::RadixKey<Datatype>");
+	READONLY u32 Bytes = RadixKey<Datatype>::Bytes;
+	if (base == nullptr || count < 2)
+		return false;
+	if (count > 0xFFFFFFFFll)
+		return true;
+	alt::Allocator<Datatype> allocator;
+	Datatype* buffer = allocator.Malloc((u32)(count));
+	if (buffer == nullptr)
+		return true;
+
+	u32 histogram[Bytes][256] = {};
+	for (i64 i = 0; i < count; i++)
+		for (u32 byte = 0; byte < Bytes; byte++)
+			histogram[byte][RadixKey<Datatype>::Digit(base[i], byte)]++;
+
+	Datatype* src = base;
+	Datatype* dst = buffer;
+	for (u32 byte = 0; byte < Bytes; byte++)
+	{
+		u32* const bucket = histogram[byte];
+		if (bucket[RadixKey<Datatype>::Digit(*src, byte)] == (u32)(count))
+			continue;
+		u32 sum = 0;
+		for (u32 digit = 0; digit < 256; digit++)
+		{
+			const u32 tmp = bucket[digit];
+			bucket[digit] = sum;
+			sum += tmp;
+		}
+		for (i64 i = 0; i < count; i++)
+			dst[bucket[RadixKey<Datatype>::Digit(src[i], byte)]++] = (Datatype&&)(src[i]);
+		Datatype* const tmp = src;
+		src = dst;
+		dst = tmp;
+	}
+	if (src != base)
+		for (i64 i = 0; i < count; i++)
+			base[i] = (Datatype&&)(src[i]);
+	allocator.Deallocate(buffer);
+	return false;
+}
+
+/// NOTE: keys with an enabled RadixKey are radix sorted once there are SORT_RADIX_THRESHOLD of them (unless they are
+/// already sorted or reversed), everything else (and anything the radix sort could not allocate for) is
+/// pattern-defeating quicksorted with alt::Less
+template <typename Datatype>
+void Sort(Datatype* const base, const i64 count)
+{
+	alt::Less<Datatype> less;
+	if constexpr (RadixKey<Datatype>::Enabled)
+		if (count >= SORT_RADIX_THRESHOLD &&
+			( _SortRun(base, base + count, less) || ! RadixSort(base, count) ))
+			return;
+	Sort(base, count, less);
+}
+
+/// NOTE: bottom-up merge sort over insertion sorted runs of SORT_MERGE_RUN elements
+/// RTRN: true if the merge buffer could not be allocated or 'count' exceeds u32, in which case nothing is moved
+template <typename Datatype, class Compare>
+bool StableSort(Datatype* const base, const i64 count, Compare less)
+{
+	if (base == nullptr || count < 2)
+		return false;
+	if (count <= SORT_MERGE_RUN)
+	{
+		_InsertionSort(base, base + count, less);
+		return false;
+	}
+	if (count > 0xFFFFFFFFll)
+		return true;
+	alt::Allocator<Datatype> allocator;
+	Datatype* buffer = allocator.Malloc((u32)(count));
+	if (buffer == nullptr)
+		return true;
+
+	for (i64 i = 0; i < count; i += SORT_MERGE_RUN)
+		_InsertionSort(base + i, base + (i + SORT_MERGE_RUN < count ? i + SORT_MERGE_RUN : count), less);
+
+	Datatype* src = base;
+	Datatype* dst = buffer;
+	for (i64 width = SORT_MERGE_RUN; width < count; width *= 2)
+	{
+		for (i64 lo = 0; lo < count; lo += 2 * width)
+		{
+			const i64 mid = lo + width     < count ? lo + width     : count;
+			const i64 hi  = lo + 2 * width < count ? lo + 2 * width : count;
+			_Merge(src + lo, src + mid, src + hi, dst + lo, less);
+		}
+		Datatype* const tmp = src;
+		src = dst;
+		dst = tmp;
+	}
+	if (src != base)
+		for (i64 i = 0; i < count; i++)
+			base[i] = (Datatype&&)(src[i]);
+	allocator.Deallocate(buffer);
+	return false;
+}
+
+/// NOTE: keys with an enabled RadixKey are radix sorted (which is stable), everything else is merge sorted
+template <typename Datatype>
+bool StableSort(Datatype* const base, const i64 count)
+{
+	alt::Less<Datatype> less;
+	if constexpr (RadixKey<Datatype>::Enabled)
+		if (count >= SORT_RADIX_THRESHOLD &&
+			( _SortRun(base, base + count, less) || ! RadixSort(base, count) ))
+			return false;
+	return StableSort(base, count, less);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end SORT_HPP
@@ -0,0 +1,213 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+
+#include <atomic> // exclusively for std::atomic
+
+namespace alt // SpscQueue belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: SpscQueue is a bounded queue between exactly one producer thread & one consumer thread, with its elements in
+/// a fixed inline ring like alt::RingArray.  Each side only ever stores its own index, so every operation is
+/// wait-free: a push or pop finishes in a bounded number of steps no matter what the other thread is doing.
+///
+/// NOTE: the producer's tail & the consumer's head each sit on their own cache line, next to that side's cached copy
+/// of the other side's index.  A side only reloads the other index (& pulls its cache line over) when its cached
+/// copy says there isn't enough room or data, so in steady state the two threads rarely touch each other's lines.
+///
+/// NOTE: TryPushN() & TryPopN() move a whole batch for the price of a single index load & store.
+///
+/// WARN: TryPush() & TryPushN() may only be called by the producer, TryPop() & TryPopN() only by the consumer
+template <typename Datatype, u64 _Capacity>
+class SpscQueue
+{
+static_assert(_Capacity > 0 && (_Capacity & (_Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+private:
+
+READONLY u64 MASK       = _Capacity - 1;
+READONLY u64 CACHE_LINE = 64;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	alignas(CACHE_LINE) std::atomic<u64> _Tail;     // The next index the producer writes, stored by the producer
+	u64                                  _HeadCache; // The producer's last look at _Head
+	alignas(CACHE_LINE) std::atomic<u64> _Head;     // The next index the consumer reads, stored by the consumer
+	u64                                  _TailCache; // The consumer's last look at _Tail
+	alignas(CACHE_LINE) Datatype         _Array[_Capacity];
+
+////////////////////////////////////////////////////////////////////////////////
+/// DEFAULT CONSTRUCTOR
+public:
+
+SpscQueue() noexcept:
+	_Tail(0),
+	_HeadCache(0),
+	_Head(0),
+	_TailCache(0),
+	_Array{}
+{}
+
+SpscQueue(const SpscQueue& copy) = delete;
+SpscQueue& operator = (const SpscQueue& copy) = delete;
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+u64 Capacity(void) const noexcept
+{
+	return _Capacity;
+}
+
+/// NOTE: exact when called by either side while the other is idle, otherwise a snapshot
+u64 Count(void) const noexcept
+{
+	const u64 head = _Head.load(std::memory_order_acquire);
+	const u64 tail = _Tail.load(std::memory_order_acquire);
+	return tail - head;
+}
+
+bool Empty(void) const noexcept
+{
+	return Count() == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// PRODUCER METHODS
+public:
+
+/// NOTE: returns true if the queue is full
+bool TryPush(const Datatype& x) noexcept
+{
+	const u64 tail = _Tail.load(std::memory_order_relaxed);
+	if (_Free(tail, 1) == 0)
+		return true;
+	_Array[tail & MASK] = x;
+	_Tail.store(tail + 1, std::memory_order_release);
+	return false;
+}
+
+/// NOTE: returns true if the queue is full, in which case 'x' is not moved from
+bool TryPush(Datatype&& x) noexcept
+{
+	const u64 tail = _Tail.load(std::memory_order_relaxed);
+	if (_Free(tail, 1) == 0)
+		return true;
+	_Array[tail & MASK] = (Datatype&&)(x);
+	_Tail.store(tail + 1, std::memory_order_release);
+	return false;
+}
+
+/// NOTE: pushes as many of 'elements' as fit, in order, & publishes them all at once
+/// RTRN: the number of elements pushed
+u64 TryPushN(const Datatype* const elements, const u64 count) noexcept
+{
+	const u64 tail   = _Tail.load(std::memory_order_relaxed);
+	const u64 free   = _Free(tail, count);
+	const u64 pushed = count < free ? count : free;
+	if (! pushed)
+		return 0;
+	const u64 slot  = tail & MASK;
+	const u64 first = _Capacity - slot < pushed ? _Capacity - slot : pushed;
+	for (u64 i = 0; i < first; i++)
+		_Array[slot + i] = elements[i];
+	for (u64 i = first; i < pushed; i++)
+		_Array[i - first] = elements[i];
+	_Tail.store(tail + pushed, std::memory_order_release);
+	return pushed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONSUMER METHODS
+public:
+
+/// NOTE: returns true if the queue is empty
+bool TryPop(Datatype& rtn) noexcept
+{
+	const u64 head = _Head.load(std::memory_order_relaxed);
+	if (_Ready(head, 1) == 0)
+		return true;
+	rtn = (Datatype&&)(_Array[head & MASK]);
+	_Head.store(head + 1, std::memory_order_release);
+	return false;
+}
+
+/// NOTE: pops up to 'count' elements into 'rtn', in order, & frees their slots all at once
+/// RTRN: the number of elements popped
+u64 TryPopN(Datatype* const rtn, const u64 count) noexcept
+{
+	const u64 head   = _Head.load(std::memory_order_relaxed);
+	const u64 ready  = _Ready(head, count);
+	const u64 popped = count < ready ? count : ready;
+	if (! popped)
+		return 0;
+	const u64 slot  = head & MASK;
+	const u64 first = _Capacity - slot < popped ? _Capacity - slot : popped;
+	for (u64 i = 0; i < first; i++)
+		rtn[i] = (Datatype&&)(_Array[slot + i]);
+	for (u64 i = first; i < popped; i++)
+		rtn[i] = (Datatype&&)(_Array[i - first]);
+	_Head.store(head + popped, std::memory_order_release);
+	return popped;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// INDEX HELPER METHODS
+private:
+
+/// NOTE: the number of free slots the producer may fill, only reloading _Head when the cached copy has fewer than
+/// 'wanted'
+u64 _Free(const u64 tail, const u64 wanted) noexcept
+{
+	if (_Capacity - (tail - _HeadCache) < wanted)
+		_HeadCache = _Head.load(std::memory_order_acquire);
+	return _Capacity - (tail - _HeadCache);
+}
+
+/// NOTE: the number of elements the consumer may take, only reloading _Tail when the cached copy has fewer than
+/// 'wanted'
+u64 _Ready(const u64 head, const u64 wanted) noexcept
+{
+	if (_TailCache - head < wanted)
+		_TailCache = _Tail.load(std::memory_order_acquire);
+	return _TailCache - head;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end SPSCQUEUE_HPP
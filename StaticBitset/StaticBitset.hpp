@@ -0,0 +1,326 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef STATICBITSET_HPP
+#define STATICBITSET_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Bits.hpp"
+
+#include <type_traits> // exclusively for std::conditional
+
+namespace alt // StaticBitset belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: StaticBitset is BitVector's fixed size counterpart, with alt::Array's inline storage: _Bits bits packed into
+/// the narrowest unsigned words which hold them (a single u8 for up to 8 bits, u64s past 32), so it's an eighth the
+/// size of an Array<bool, _Bits> & never allocates.  Every bulk operation works a whole word at a time, FindFirst(),
+/// FindNext(), & ForEach() skip empty words & find the set bits within a word by counting trailing zeros.
+///
+/// NOTE: StaticBitset is a trivially copyable literal type, so every method works in constant expressions wherever
+/// alt::PopCount() & alt::CountTrailingZeros() do (everywhere but MSVC).  The bits past _Bits in the last word are
+/// always zero.
+template <u64 _Bits>
+class StaticBitset
+{
+static_assert(_Bits > 0, "StaticBitset requires at least one bit");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+private:
+
+using _Word = typename std::conditional<(_Bits <= 8), u8,
+              typename std::conditional<(_Bits <= 16), u16,
+              typename std::conditional<(_Bits <= 32), u32, u64>::type>::type>::type;
+
+READONLY u64   WORD_BITS = sizeof(_Word) * 8;
+READONLY u64   WORDS     = (_Bits + WORD_BITS - 1) / WORD_BITS;
+READONLY _Word ONES      = (_Word)(~(_Word)(0));
+READONLY _Word TAIL      = _Bits % WORD_BITS ? (_Word)(ONES >> (WORD_BITS - _Bits % WORD_BITS)) : ONES;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	_Word _Words[WORDS];
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONSTRUCTORS
+public:
+
+constexpr StaticBitset() noexcept:
+	_Words{}
+{}
+
+/// NOTE: sets the bits of 'bits' below _Bits, e.g. StaticBitset<8>(0b101) has bits 0 & 2 set
+constexpr explicit StaticBitset(const u64 bits) noexcept:
+	_Words{}
+{
+	for (u64 i = 0; i < WORDS && i * WORD_BITS < 64; i++)
+		_Words[i] = (_Word)(bits >> (i * WORD_BITS));
+	_Words[WORDS - 1] &= TAIL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE ACCESSORS
+public:
+
+constexpr u64 Size(void) const noexcept
+{
+	return _Bits;
+}
+
+/// NOTE: the number of words holding the bits, which Words() points to
+constexpr u64 WordCount(void) const noexcept
+{
+	return WORDS;
+}
+
+constexpr const _Word* Words(void) const noexcept
+{
+	return _Words;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// BIT ACCESSORS & MODIFIERS
+public:
+
+constexpr bool At(const u64 index) const
+{
+	if (index >= _Bits)
+		throw alt::InvalidIndex();
+	return this->operator [] (index);
+}
+
+constexpr bool operator [] (const u64 index) const noexcept
+{
+	return (_Words[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+}
+
+/// NOTE: returns false if 'index' is out of bounds
+constexpr bool Test(const u64 index) const noexcept
+{
+	return index < _Bits && this->operator [] (index);
+}
+
+/// NOTE: each modifier returns true if 'index' is out of bounds
+constexpr bool Set(const u64 index, const bool value = true) noexcept
+{
+	if (index >= _Bits)
+		return true;
+	const _Word mask = (_Word)((_Word)(1) << (index % WORD_BITS));
+	_Words[index / WORD_BITS] = (_Word)((_Words[index / WORD_BITS] & ~mask) | (value ? mask : 0));
+	return false;
+}
+
+constexpr bool Reset(const u64 index) noexcept
+{
+	return Set(index, false);
+}
+
+constexpr bool Flip(const u64 index) noexcept
+{
+	if (index >= _Bits)
+		return true;
+	_Words[index / WORD_BITS] ^= (_Word)((_Word)(1) << (index % WORD_BITS));
+	return false;
+}
+
+constexpr void SetAll(void) noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		_Words[i] = ONES;
+	_Words[WORDS - 1] = TAIL;
+}
+
+constexpr void ResetAll(void) noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		_Words[i] = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// WORD OPERATIONS
+public:
+
+constexpr StaticBitset& operator &= (const StaticBitset& that) noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		_Words[i] &= that._Words[i];
+	return *this;
+}
+
+constexpr StaticBitset& operator |= (const StaticBitset& that) noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		_Words[i] |= that._Words[i];
+	return *this;
+}
+
+constexpr StaticBitset& operator ^= (const StaticBitset& that) noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		_Words[i] ^= that._Words[i];
+	return *this;
+}
+
+/// NOTE: clears every bit which is set in 'that'
+constexpr StaticBitset& AndNot(const StaticBitset& that) noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		_Words[i] &= (_Word)(~that._Words[i]);
+	return *this;
+}
+
+constexpr StaticBitset& Not(void) noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		_Words[i] = (_Word)(~_Words[i]);
+	_Words[WORDS - 1] &= TAIL;
+	return *this;
+}
+
+constexpr StaticBitset operator & (const StaticBitset& that) const noexcept
+{
+	return StaticBitset(*this) &= that;
+}
+
+constexpr StaticBitset operator | (const StaticBitset& that) const noexcept
+{
+	return StaticBitset(*this) |= that;
+}
+
+constexpr StaticBitset operator ^ (const StaticBitset& that) const noexcept
+{
+	return StaticBitset(*this) ^= that;
+}
+
+constexpr StaticBitset operator ~ (void) const noexcept
+{
+	return StaticBitset(*this).Not();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COUNTING & SEARCH METHODS
+public:
+
+/// NOTE: the number of set bits
+constexpr u64 Count(void) const noexcept
+{
+	u64 rtn = 0;
+	for (u64 i = 0; i < WORDS; i++)
+		rtn += alt::PopCount(_Words[i]);
+	return rtn;
+}
+
+constexpr bool Any(void) const noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		if (_Words[i])
+			return true;
+	return false;
+}
+
+constexpr bool None(void) const noexcept
+{
+	return ! Any();
+}
+
+constexpr bool All(void) const noexcept
+{
+	for (u64 i = 0; i + 1 < WORDS; i++)
+		if (_Words[i] != ONES)
+			return false;
+	return _Words[WORDS - 1] == TAIL;
+}
+
+/// NOTE: the index of the first set bit, or -1 if none are set
+constexpr i64 FindFirst(void) const noexcept
+{
+	return _Find(0);
+}
+
+/// NOTE: the index of the first set bit after 'index', or -1 if there are none
+constexpr i64 FindNext(const u64 index) const noexcept
+{
+	return index + 1 < _Bits ? _Find(index + 1) : -1;
+}
+
+/// NOTE: calls visit(index) for every set bit in ascending order, a word at a time
+template <class Visitor>
+constexpr void ForEach(Visitor visit) const
+{
+	for (u64 i = 0; i < WORDS; i++)
+		for (u64 bits = _Words[i]; bits; bits &= bits - 1)
+			visit(i * WORD_BITS + alt::CountTrailingZeros(bits));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// COMPARISON OPERATORS
+public:
+
+constexpr bool Equals(const StaticBitset& that) const noexcept
+{
+	for (u64 i = 0; i < WORDS; i++)
+		if (this->_Words[i] != that._Words[i])
+			return false;
+	return true;
+}
+
+constexpr bool operator == (const StaticBitset& that) const noexcept
+{
+	return this->Equals(that);
+}
+
+/// NOTE: returns the opposite of operator ==
+constexpr bool operator != (const StaticBitset& that) const noexcept
+{
+	return ! this->operator == (that);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// HELPER METHODS
+private:
+
+constexpr i64 _Find(const u64 index) const noexcept
+{
+	u64 word = index / WORD_BITS;
+	u64 bits = _Words[word] & (ONES << (index % WORD_BITS));
+	while (! bits)
+	{
+		if (++word == WORDS)
+			return -1;
+		bits = _Words[word];
+	}
+	return (i64)(word * WORD_BITS + alt::CountTrailingZeros(bits));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end STATICBITSET_HPP
@@ -0,0 +1,339 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef STATICHASHMAP_HPP
+#define STATICHASHMAP_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+
+#include <cstring>     // exclusively for std::memcpy
+#include <type_traits> // exclusively for std::enable_if, std::conditional, & the type predicates
+
+namespace alt // StaticHashMap belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: the 64-bit MurmurHash3 finalizer
+constexpr u64 _HashMix(u64 x) noexcept
+{
+	x ^= x >> 33;
+	x *= 0xFF51AFD7ED558CCD;
+	x ^= x >> 33;
+	x *= 0xC4CEB9FE1A85EC53;
+	x ^= x >> 33;
+	return x;
+}
+
+/// NOTE: Hash is StaticHashMap's default hash function.  Integers, enums, & pointers are hashed by value with the
+/// MurmurHash3 finalizer, which spreads every input bit across the whole result so that the low bits used as a
+/// slot are well mixed.  Other types are hashed by their bytes when those uniquely represent their value, anything
+/// else (e.g. floats, where 0.0 == -0.0, or types holding pointers) needs a Hash specialization or its own hasher.
+template <typename Datatype, typename Enable = void>
+class Hash
+{
+static_assert(std::has_unique_object_representations<Datatype>::value,
+              "alt::Hash can't hash this type by its bytes, specialize alt::Hash or give StaticHashMap a hasher");
+
+public:
+
+u64 operator () (const Datatype& x) const noexcept
+{
+	u8 bytes[sizeof(Datatype)];
+	std::memcpy(bytes, &x, sizeof(Datatype));
+	u64 rtn = 0xCBF29CE484222325; // FNV-1a
+	for (u64 i = 0; i < sizeof(Datatype); i++)
+		rtn = (rtn ^ bytes[i]) * 0x100000001B3;
+	return _HashMix(rtn);
+}
+
+};
+
+template <typename Datatype>
+class Hash<Datatype, typename std::enable_if<std::is_integral<Datatype>::value || std::is_enum<Datatype>::value ||
+                                             std::is_pointer<Datatype>::value>::type>
+{
+public:
+
+u64 operator () (const Datatype& x) const noexcept
+{
+	return _HashMix((u64)(x));
+}
+
+};
+
+/// NOTE: StaticHashMap is an open addressing hash map whose slots live inside the object, so it never allocates; a
+/// thread or connection can keep one on its stack or inside another object.  Collisions are resolved by robin hood
+/// linear probing: an insertion takes the slot of any key which sits closer to its own home slot than the new key
+/// does, which keeps probe sequences short & lets a lookup stop at the first key which is closer to home than it
+/// would be.  Removal shifts the following keys back a slot instead of leaving a tombstone, so the table never needs
+/// to be rebuilt & lookups never slow down as keys come & go.
+///
+/// NOTE: the probe distance of each slot is kept in its own narrow array, so a lookup mostly scans a few bytes
+/// before touching a key.  Keys & values must be default constructible, an empty slot holds value initialized ones.
+/// The capacity must be a power of two, & every slot can be filled, though lookups slow as the map approaches full.
+template < typename Keytype, typename Valuetype, i64 _Capacity, class Hasher = alt::Hash<Keytype> >
+class StaticHashMap
+{
+static_assert(_Capacity > 0 && (_Capacity & (_Capacity - 1)) == 0, "StaticHashMap capacity must be a power of two");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+READONLY i64 MASK = _Capacity - 1;
+
+/// NOTE: one more than the distance of a slot's key from its home slot, or zero if the slot is empty
+using _Distance = typename std::conditional<(_Capacity <= 0xFF), u8,
+                  typename std::conditional<(_Capacity <= 0xFFFF), u16, u32>::type>::type;
+
+	_Distance  _Probes[_Capacity];
+	Keytype    _Keys[_Capacity];
+	Valuetype  _Values[_Capacity];
+	i64        _Count;
+	Hasher     _Hash;
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONSTRUCTORS
+public:
+
+StaticHashMap() noexcept:
+	_Probes{},
+	_Keys{},
+	_Values{},
+	_Count(0),
+	_Hash()
+{}
+
+explicit StaticHashMap(const Hasher& hash) noexcept:
+	_Probes{},
+	_Keys{},
+	_Values{},
+	_Count(0),
+	_Hash(hash)
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+/// SIZE & CAPACITY ACCESSORS
+public:
+
+i64 Count(void) const noexcept
+{
+	return _Count;
+}
+
+i64 Capacity(void) const noexcept
+{
+	return _Capacity;
+}
+
+bool Empty(void) const noexcept
+{
+	return _Count == 0;
+}
+
+bool Full(void) const noexcept
+{
+	return _Count == _Capacity;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// MEMORY ACCESSORS
+public:
+
+bool Contains(const Keytype& key) const noexcept
+{
+	return _Lookup(key) >= 0;
+}
+
+/// NOTE: returns nullptr if 'key' is not in the map
+const Valuetype* Find(const Keytype& key) const noexcept
+{
+	const i64 slot = _Lookup(key);
+	return slot < 0 ? nullptr : &_Values[slot];
+}
+
+/// NOTE: returns nullptr if 'key' is not in the map
+Valuetype* Find(const Keytype& key) noexcept
+{
+	const i64 slot = _Lookup(key);
+	return slot < 0 ? nullptr : &_Values[slot];
+}
+
+/// NOTE: throws alt::InvalidIndex if 'key' is not in the map
+const Valuetype& At(const Keytype& key) const
+{
+	const Valuetype* const value = Find(key);
+	if (! value)
+		throw alt::InvalidIndex();
+	return *value;
+}
+
+/// NOTE: throws alt::InvalidIndex if 'key' is not in the map
+Valuetype& At(const Keytype& key)
+{
+	Valuetype* const value = Find(key);
+	if (! value)
+		throw alt::InvalidIndex();
+	return *value;
+}
+
+/// NOTE: calls visit(key, value) for every pair, in slot order
+template <class Visitor>
+void ForEach(Visitor visit) const
+{
+	for (i64 slot = 0; slot < _Capacity; slot++)
+		if (_Probes[slot])
+			visit(_Keys[slot], _Values[slot]);
+}
+
+template <class Visitor>
+void ForEach(Visitor visit)
+{
+	for (i64 slot = 0; slot < _Capacity; slot++)
+		if (_Probes[slot])
+			visit((const Keytype&)(_Keys[slot]), _Values[slot]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONTAINER METHODS
+public:
+
+/// NOTE: overwrites the value of 'key' if it is already in the map, returns true if it isn't & the map is full
+bool Insert(const Keytype& key, const Valuetype& value) noexcept
+{
+	i64 slot = _Home(key);
+	_Distance probe = 1;
+	for (; _Probes[slot] >= probe; slot = (slot + 1) & MASK, probe++)
+		if (_Probes[slot] == probe && _Keys[slot] == key)
+		{
+			_Values[slot] = value;
+			return false;
+		}
+	if (Full())
+		return true;
+	_Place(slot, probe, Keytype(key), Valuetype(value));
+	return false;
+}
+
+/// NOTE: returns true if 'key' is not in the map
+bool Remove(const Keytype& key) noexcept
+{
+	i64 slot = _Lookup(key);
+	if (slot < 0)
+		return true;
+	for (i64 next = (slot + 1) & MASK; _Probes[next] > 1; slot = next, next = (next + 1) & MASK)
+	{
+		_Probes[slot] = (_Distance)(_Probes[next] - 1);
+		_Keys[slot]   = (Keytype&&)(_Keys[next]);
+		_Values[slot] = (Valuetype&&)(_Values[next]);
+	}
+	_Probes[slot] = 0;
+	_Keys[slot]   = Keytype {};
+	_Values[slot] = Valuetype {};
+	_Count--;
+	return false;
+}
+
+/// NOTE: returns true if 'key' is not in the map, otherwise moves its value into 'rtn' & removes it
+bool Remove(const Keytype& key, Valuetype& rtn) noexcept
+{
+	Valuetype* const value = Find(key);
+	if (! value)
+		return true;
+	rtn = (Valuetype&&)(*value);
+	return Remove(key);
+}
+
+void Erase(void) noexcept
+{
+	for (i64 slot = 0; slot < _Capacity; slot++)
+		if (_Probes[slot])
+		{
+			_Probes[slot] = 0;
+			_Keys[slot]   = Keytype {};
+			_Values[slot] = Valuetype {};
+		}
+	_Count = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// HELPER METHODS
+private:
+
+i64 _Home(const Keytype& key) const noexcept
+{
+	return (i64)(_Hash(key) & (u64)(MASK));
+}
+
+/// NOTE: returns the slot holding 'key', or -1 if there is none.  The probe stops at the first slot whose key is
+/// closer to its home than 'key' would be, because an insertion of 'key' would have taken that slot.
+i64 _Lookup(const Keytype& key) const noexcept
+{
+	i64 slot = _Home(key);
+	for (_Distance probe = 1; _Probes[slot] >= probe; slot = (slot + 1) & MASK, probe++)
+		if (_Probes[slot] == probe && _Keys[slot] == key)
+			return slot;
+	return -1;
+}
+
+/// NOTE: puts the pair in 'slot', then carries whichever pair it displaces on down the table until an empty slot
+/// WARN: the map must not be full
+void _Place(i64 slot, _Distance probe, Keytype&& key, Valuetype&& value) noexcept
+{
+	for (;; slot = (slot + 1) & MASK, probe++)
+	{
+		if (! _Probes[slot])
+		{
+			_Probes[slot] = probe;
+			_Keys[slot]   = (Keytype&&)(key);
+			_Values[slot] = (Valuetype&&)(value);
+			_Count++;
+			return;
+		}
+		if (_Probes[slot] < probe)
+		{
+			const _Distance displaced = _Probes[slot];
+			_Probes[slot] = probe;
+			probe = displaced;
+			_Swap(_Keys[slot], key);
+			_Swap(_Values[slot], value);
+		}
+	}
+}
+
+template <typename Datatype>
+static void _Swap(Datatype& lhs, Datatype& rhs) noexcept
+{
+	Datatype tmp = (Datatype&&)(lhs);
+	lhs = (Datatype&&)(rhs);
+	rhs = (Datatype&&)(tmp);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end STATICHASHMAP_HPP
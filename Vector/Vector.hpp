@@ -22,19 +22,28 @@
 #ifndef VECTOR_hpp
 #define VECTOR_hpp
 
-#include <cstring>  // exclusively for std::memcpy()
+#include <cstring>      // exclusively for std::memcpy() & std::memmove()
+#include <type_traits>  // exclusively for std::is_trivially_copyable
 
 #include "Keywords.hpp"
 #include "Types.hpp"
 #include "Exceptions.hpp"
 #include "Allocator.hpp"
+#include "Sort.hpp"
+#include "VectorStats.hpp"
+#include "VectorGrowth.hpp"
 
 namespace alt   // Vector belongs to namespace alt
 {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template < typename Datatype, class Allocator = alt::Allocator<Datatype> >
-class Vector
+/// NOTE: the Instrument policy is told about every reallocation, shift, & deep copy, see VectorStats.hpp
+/// NOTE: the Growth policy picks the capacity of every growth event, see VectorGrowth.hpp
+template < typename Datatype, class Allocator = alt::Allocator<Datatype>, class Instrument = alt::DefaultVectorStats,
+           class Growth = alt::DoublingGrowth >
+class Vector:
+    private Instrument,
+    private Growth
 {
 ////////////////////////////////////////////////////////////
 
@@ -42,7 +51,6 @@ class Vector
 private:
     u32       Count_;       // The number of elements in the Vector
     u32       Length_;      // The total number of elements the Vector can hold before a growth event
-    u16       Growth_;      // The percent growth of the Vector's length during a growth event
     Allocator Allocator_;   // The memory Allocator of the Vector
     Datatype* Array_;       // The array of elements held in the Vector
 
@@ -51,9 +59,10 @@ private:
 public:
 
 Vector() noexcept: // default constructor
+    Instrument(),
+    Growth(),
     Count_(0),
     Length_(0),
-    Growth_(100),
     Allocator_(),
     Array_(nullptr)
 {}
@@ -70,6 +79,7 @@ bool Init(u32 initLength = 1)
         return true;
     Array_ = Allocator_.Allocate(initLength);
     Length_ = initLength;
+    Stats().OnAllocate(Length_);
     return false;
 }
 
@@ -78,32 +88,22 @@ bool Init(u32 initLength = 1)
 public:
 
 Vector(u32 initLength):
+    Instrument(),
+    Growth(),
     Count_(0),
     Length_(initLength),
-    Growth_(100),
-    Allocator_(),
-    Array_(nullptr)
-{
-    if (Length_)
-        Array_ = Allocator_.Allocate(Length_);
-}
-
-explicit Vector(u32 initLength, u16 percentGrowthRate):
-    Count_(0),
-    Length_(initLength),
-    Growth_(percentGrowthRate),
     Allocator_(),
     Array_(nullptr)
 {
     if (Length_)
         Array_ = Allocator_.Allocate(Length_);
+    Stats().OnAllocate(Length_);
 }
 
 /// ARRAY INJECTION CONSTRUCTOR TBD
 // explicit Vector(Datatype* initArray, u32 initCount, u32 initLength) noexcept:
 //     Count_(initCount),
 //     Length_(initLength),
-//     Growth_(100),
 //     Allocator_(),
 //     Array_(initArray)
 // {}
@@ -113,26 +113,32 @@ explicit Vector(u32 initLength, u16 percentGrowthRate):
 public:
 
 Vector(const Vector& copy): // copy constructor
+    Instrument(copy),
+    Growth(copy),
     Count_(copy.Count_),
     Length_(copy.Length_),
-    Growth_(copy.Growth_),
     Allocator_(copy.Allocator_),
     Array_(nullptr)
 {
     if (this->Length_)
     {
         this->Array_ = this->Allocator_.Allocate(this->Length_);
-        std::memcpy(this->Array_, copy.Array_, this->Length_);
+        std::memcpy(this->Array_, copy.Array_, DataSize(this->Count_));
     }
+    Stats().OnAllocate(this->Length_);
+    Stats().OnCopy(DataSize(this->Count_));
 }
 
 Vector(Vector&& move) noexcept: // move constructor
+    Instrument((Instrument&&)(move)),
+    Growth((Growth&&)(move)),
     Count_(move.Count_),
     Length_(move.Length_),
-    Growth_(move.Growth_),
     Allocator_((Allocator&&)(move.Allocator_)),
     Array_(move.Array_)
 {
+    move.Count_  = 0;
+    move.Length_ = 0;
     move.Array_  = nullptr;
 }
 
@@ -141,15 +147,17 @@ Vector& operator = (const Vector& copy)
     this->Allocator_.Deallocate(this->Array_);
     this->Count_     = copy.Count_;
     this->Length_    = copy.Length_;
-    this->Growth_    = copy.Growth_;
     this->Allocator_ = copy.Allocator_;
+    this->GrowthPolicy() = copy.GrowthPolicy();
     if (this->Length_)
     {
         this->Array_ = this->Allocator_.Allocate(this->Length_);
-        std::memcpy(this->Array_, copy.Array_, this->Length_);
+        std::memcpy(this->Array_, copy.Array_, DataSize(this->Count_));
     }
     else
         this->Array_ = nullptr;
+    Stats().OnAllocate(this->Length_);
+    Stats().OnCopy(DataSize(this->Count_));
     return *this;
 }
 
@@ -158,10 +166,37 @@ Vector& operator = (Vector&& move) noexcept
     this->Allocator_.Deallocate(this->Array_);
     this->Count_     = move.Count_;
     this->Length_    = move.Length_;
-    this->Growth_    = move.Growth_;
     this->Allocator_ = (Allocator&&)(move.Allocator_);
     this->Array_     = move.Array_;
+    move.Count_      = 0;
+    move.Length_     = 0;
     move.Array_      = nullptr;
+    this->GrowthPolicy() = move.GrowthPolicy();
+    return *this;
+}
+
+////////////////////////////////////////////////////////////
+/// POLICY ACCESSORS
+public:
+
+/// NOTE: the Instrument policy of this Vector, which is an empty alt::NoVectorStats unless instrumentation was selected
+Instrument& Stats(void) noexcept
+{
+    return *this;
+}
+
+const Instrument& Stats(void) const noexcept
+{
+    return *this;
+}
+
+Growth& GrowthPolicy(void) noexcept
+{
+    return *this;
+}
+
+const Growth& GrowthPolicy(void) const noexcept
+{
     return *this;
 }
 
@@ -169,7 +204,7 @@ Vector& operator = (Vector&& move) noexcept
 /// SIZE & CAPACITY ACCESSORS
 public:
 
-u32 DataSize(u32 num = 1) const
+u64 DataSize(u64 num = 1) const
 {
     return sizeof(Datatype) * num;
 }
@@ -212,9 +247,7 @@ bool Resize(u32 newCapacity)
 
 bool Grow(void)
 {
-    if (Length_)
-        return Grow((Length_ * (Growth_ + 100)) / 100);
-    return Grow((Growth_ + 100) / 100);
+    return Grow(GrowthPolicy().Next(Length_, Length_ + (Length_ < GROWTH_MAXIMUM_CAPACITY), sizeof(Datatype)));
 }
 
 bool Grow(u32 newCapacity)
@@ -222,7 +255,9 @@ bool Grow(u32 newCapacity)
     if (newCapacity <= Length_)
         return true;
     Datatype* newArray = Allocator_.Allocate(newCapacity);
-    std::memcpy(newArray, Array_, DataSize(Count_));
+    if (Count_)
+        std::memcpy(newArray, Array_, DataSize(Count_));
+    Stats().OnGrow(newCapacity, DataSize(Count_));
     Allocator_.Deallocate(Array_);
     Length_ = newCapacity;
     Array_  = newArray;
@@ -241,7 +276,10 @@ bool Shrink(u32 newCapacity)
         newCapacity >= Length_)
         return true;
     Datatype* newArray = Allocator_.Allocate(newCapacity);
-    std::memcpy(newArray, Array_, DataSize(Count_));
+    if (Count_)
+        std::memcpy(newArray, Array_, DataSize(Count_));
+    Stats().OnShrink(newCapacity, DataSize(Count_));
+    GrowthPolicy().OnShrink();
     Allocator_.Deallocate(Array_);
     Length_ = newCapacity;
     Array_  = newArray;
@@ -259,6 +297,8 @@ bool Truncate(u32 newCapacity)
         newArray = Allocator_.Allocate(newCapacity);
         std::memcpy(newArray, Array_, DataSize(newCapacity));
     }
+    Stats().OnTruncate(newCapacity, DataSize(newCapacity));
+    GrowthPolicy().OnShrink();
     Allocator_.Deallocate(Array_);
     Count_  = newCapacity;
     Length_ = newCapacity;
@@ -266,6 +306,20 @@ bool Truncate(u32 newCapacity)
     return false;
 }
 
+/// NOTE: appends 'count' elements without assigning them, for callers which fill Data() + the old Size() in place
+/// (e.g. alt::Load()), returns true if the combined count doesn't fit in a Vector
+bool Extend(u32 count)
+{
+    const u64 required = (u64)(Count_) + count;
+    if (required > GROWTH_MAXIMUM_CAPACITY)
+        return true;
+    if (required > Length_ &&
+        Grow(GrowthPolicy().Next(Length_, (u32)(required), sizeof(Datatype))))
+        return true;
+    Count_ = (u32)(required);
+    return false;
+}
+
 ////////////////////////////////////////////////////////////
 /// MEMORY ACCESSORS & MODIFIERS
 public:
@@ -295,6 +349,17 @@ Datatype& operator [] (u32 index)
     return Array_[index];
 }
 
+const Datatype* Data(void) const
+{
+    return Array_;
+}
+
+/// WARNING: this method can destroy the Count_ invariant
+Datatype* Data(void)
+{
+    return Array_;
+}
+
 /// NOTE: includes bounds checking, and cannot destroy the Count_ invariant
 bool Swap(u32 index1st, u32 index2nd)
 {
@@ -371,6 +436,47 @@ bool LastIndexOf(const Datatype& x, u32& rtn) const
     return false;
 }
 
+////////////////////////////////////////////////////////////
+/// SORTING METHODS
+public:
+
+/// NOTE: integral, floating point, & alt::u128 elements are radix sorted, everything else is pattern-defeating
+/// quicksorted using operator <
+void Sort(void)
+{
+    alt::Sort(Array_, Count_);
+}
+
+template <class Compare>
+void Sort(Compare less)
+{
+    alt::Sort(Array_, Count_, less);
+}
+
+/// NOTE: returns true if the scratch buffer could not be allocated, in which case the Vector is left untouched
+bool StableSort(void)
+{
+    return alt::StableSort(Array_, Count_);
+}
+
+/// NOTE: returns true if the scratch buffer could not be allocated, in which case the Vector is left untouched
+template <class Compare>
+bool StableSort(Compare less)
+{
+    return alt::StableSort(Array_, Count_, less);
+}
+
+bool IsSorted(void) const
+{
+    return alt::IsSorted(Array_, Count_);
+}
+
+template <class Compare>
+bool IsSorted(Compare less) const
+{
+    return alt::IsSorted(Array_, Count_, less);
+}
+
 ////////////////////////////////////////////////////////////
 /// CONTAINER METHODS
 public:
@@ -388,6 +494,7 @@ bool PushFront(const Datatype& x)
     if (Full() &&
         Grow())
         return true;
+    Stats().OnShift(Count_);
     Datatype* const end = Array_;
     Datatype* ptr = end + Count_;
     for (; ptr > end; ptr--)
@@ -445,6 +552,7 @@ bool Insert(u32 index, const Datatype& x)
         return true;
     if (index > Count_)
         return true;
+    Stats().OnShift(Count_ - index);
     Datatype* const end = Array_ + index;
     Datatype* ptr = Array_ + Count_;
     for (; ptr > end; ptr--)
@@ -459,6 +567,7 @@ bool Remove(u32 index)
     if (index >= Count_)
         return true;
     Count_--;
+    Stats().OnShift(Count_ - index);
     Datatype* ptr = Array_ + index;
     Datatype* const end = Array_ + Count_;
     for (; ptr < end; ptr++)
@@ -466,6 +575,86 @@ bool Remove(u32 index)
     return false;
 }
 
+/// NOTE: O(1), the last element is moved into 'index' so the order of the Vector is not preserved
+bool SwapRemove(u32 index)
+{
+    if (index >= Count_)
+        return true;
+    Count_--;
+    if (index != Count_)
+    {
+        Array_[index] = (Datatype&&)(Array_[Count_]);
+        Stats().OnShift(1);
+    }
+    return false;
+}
+
+/// NOTE: removes every element 'predicate' returns true for in a single stable pass, returns the number removed
+/// NOTE: trivially copyable elements are compacted branch-free, every element is written and the write cursor only
+/// advances past the elements which are kept
+template <class Predicate>
+u32 RemoveIf(Predicate predicate)
+{
+    Datatype* src = Array_;
+    Datatype* const end = Array_ + Count_;
+    for (; src < end && ! predicate(*src); src++);
+    if (src == end)
+        return 0;
+    Datatype* const first = src;
+    Datatype* dst = src;
+    if constexpr (std::is_trivially_copyable<Datatype>::value)
+    {
+        for (src++; src < end; src++)
+        {
+            const bool remove = predicate(*src);
+            *dst = *src;
+            dst += ! remove;
+        }
+    }
+    else
+    {
+        for (src++; src < end; src++)
+            if (! predicate(*src))
+                *dst++ = (Datatype&&)(*src);
+    }
+    const u32 removed = (u32)(end - dst);
+    Count_ -= removed;
+    Stats().OnShift((u64)(dst - first));
+    return removed;
+}
+
+/// NOTE: removes the elements at 'indices' in a single stable pass, moving each surviving gap exactly once
+/// NOTE: 'indices' must be strictly ascending and in bounds, otherwise this method fails and returns true without
+/// removing anything
+bool RemoveIndices(const u32* const indices, u32 count)
+{
+    if (! count)
+        return false;
+    if (! indices ||
+        indices[count - 1] >= Count_)
+        return true;
+    for (u32 i = 1; i < count; i++)
+        if (indices[i] <= indices[i - 1])
+            return true;
+    Stats().OnShift(Count_ - indices[0] - count);
+    u32 dst = indices[0];
+    for (u32 i = 0; i < count; i++)
+    {
+        const u32 src = indices[i] + 1;
+        const u32 end = (i + 1 < count) ? indices[i + 1] : Count_;
+        if constexpr (std::is_trivially_copyable<Datatype>::value)
+        {
+            std::memmove(Array_ + dst, Array_ + src, DataSize(end - src));
+            dst += end - src;
+        }
+        else
+            for (u32 j = src; j < end; j++)
+                Array_[dst++] = (Datatype&&)(Array_[j]);
+    }
+    Count_ = dst;
+    return false;
+}
+
 void Erase(void)
 {
     Count_ = 0;
@@ -475,16 +664,23 @@ void Erase(void)
 /// VECTOR OPERATION METHODS
 public:
 
-void Append(const Vector& that)
+/// NOTE: returns true if the combined count doesn't fit in a Vector
+bool Append(const Vector& that)
 {
-    this->Resize(this->Length_ + that.Length_);
-    std::memcpy(this->Array_ + this->Count_, that.Array_, DataSize(that.Count_));
-    this->Count_ += that.Count_;
+    const u64 count = (u64)(this->Count_) + that.Count_;
+    if (count > GROWTH_MAXIMUM_CAPACITY)
+        return true;
+    if (count > this->Length_)
+        this->Grow(GrowthPolicy().Next(this->Length_, (u32)(count), sizeof(Datatype)));
+    if (that.Count_)
+        std::memcpy(this->Array_ + this->Count_, that.Array_, DataSize(that.Count_));
+    this->Count_ = (u32)(count);
+    return false;
 }
 
-void operator += (const Vector& that)
+bool operator += (const Vector& that)
 {
-    this->Append(that);
+    return this->Append(that);
 }
 
 /// NOTE: only checks for list equivalency, not object equivalency - less rigorous than alt::Vector::operator==()
@@ -505,7 +701,6 @@ bool Equals(const Vector& that) const
 bool operator == (const Vector& that) const
 {
     if (this->Length_    != that.Length_ ||
-        this->Growth_    != that.Growth_ ||
         this->Allocator_ != that.Allocator_)
         return false;
     return this->Equals(that);
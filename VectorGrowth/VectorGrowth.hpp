@@ -0,0 +1,179 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef VECTORGROWTH_HPP
+#define VECTORGROWTH_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Bits.hpp"
+
+namespace alt // VectorGrowth belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: alt::Vector asks its Growth policy for the capacity of every growth event.  A policy provides
+///   - u32 Next(u32 length, u32 required, u64 elementSize) ~ the new capacity, at least 'required' whenever that fits
+///                                                           in a u32, & never less than 'length'
+///   - void OnShrink(void)                                 ~ called after every Shrink() & Truncate()
+/// & is an empty base class of Vector unless it keeps state, as AdaptiveGrowth does.  Every policy computes in u64 &
+/// saturates at GROWTH_MAXIMUM_CAPACITY, so a full Vector reports failure instead of wrapping around to a tiny array.
+
+READONLY u32 GROWTH_MAXIMUM_CAPACITY = 0xFFFFFFFFu;
+READONLY u32 GROWTH_MINIMUM_CAPACITY = 2;
+
+/// NOTE: clamps 'capacity' to [required, GROWTH_MAXIMUM_CAPACITY]
+inline u32 _GrowthClamp(const u64 capacity, const u32 required) noexcept
+{
+	if (capacity < required)
+		return required;
+	return capacity < GROWTH_MAXIMUM_CAPACITY ? (u32)(capacity) : GROWTH_MAXIMUM_CAPACITY;
+}
+
+/// NOTE: the default, doubles with a shift
+class DoublingGrowth
+{
+public:
+
+	u32 Next(const u32 length, const u32 required, const u64) const noexcept
+	{
+		return _GrowthClamp(length ? (u64)(length) << 1 : GROWTH_MINIMUM_CAPACITY, required);
+	}
+
+	void OnShrink(void) noexcept {}
+};
+
+/// NOTE: grows by 1.5x with a shift & an add, which wastes less memory than doubling at the cost of more reallocations
+class ThreeHalvesGrowth
+{
+public:
+
+	u32 Next(const u32 length, const u32 required, const u64) const noexcept
+	{
+		return _GrowthClamp(length ? (u64)(length) + (length >> 1) + 1 : GROWTH_MINIMUM_CAPACITY, required);
+	}
+
+	void OnShrink(void) noexcept {}
+};
+
+/// NOTE: grows by a compile time percentage, which the compiler turns into a multiply & a shift
+template <u32 Percent>
+class PercentGrowth
+{
+	static_assert(Percent > 0, "PercentGrowth must grow");
+
+public:
+
+	u32 Next(const u32 length, const u32 required, const u64) const noexcept
+	{
+		const u64 grown = (u64)(length) + (u64)(length) * Percent / 100;
+		return _GrowthClamp(grown > length ? grown : (u64)(length) + GROWTH_MINIMUM_CAPACITY, required);
+	}
+
+	void OnShrink(void) noexcept {}
+};
+
+/// NOTE: rounds the capacity 'Base' asks for up to the next allocator size class, so the slack the allocator would
+/// hand out anyway becomes usable capacity.  The classes follow the common jemalloc & tcmalloc spacing of four classes
+/// per power of two, with a minimum of SIZE_CLASS_MINIMUM bytes.
+template <class Base = DoublingGrowth>
+class SizeClassGrowth:
+	private Base
+{
+public:
+
+	READONLY u64 SIZE_CLASS_MINIMUM = 16;
+
+	/// NOTE: not const, so that a stateful Base such as AdaptiveGrowth still learns from every growth event
+	u32 Next(const u32 length, const u32 required, const u64 elementSize) noexcept
+	{
+		const u32 capacity = Base::Next(length, required, elementSize);
+		if (! elementSize)
+			return capacity;
+		return _GrowthClamp(SizeClass(capacity * elementSize) / elementSize, capacity);
+	}
+
+	void OnShrink(void) noexcept
+	{
+		Base::OnShrink();
+	}
+
+	const Base& BasePolicy(void) const noexcept
+	{
+		return *this;
+	}
+
+	/// NOTE: the smallest size class holding 'bytes'
+	static u64 SizeClass(const u64 bytes) noexcept
+	{
+		if (bytes <= SIZE_CLASS_MINIMUM)
+			return SIZE_CLASS_MINIMUM;
+		const u64 step = (u64)(1) << (alt::Log2Floor(bytes - 1) - 2);
+		return (bytes + step - 1) & ~(step - 1);
+	}
+};
+
+/// NOTE: learns how fast a Vector is growing.  Every growth event in a row raises the factor by ADAPTIVE_STEP eighths,
+/// from 1.5x up to 4x, since a Vector that keeps growing is likely to keep growing & fewer, larger reallocations then
+/// move fewer bytes in total.  A Shrink() or Truncate() means the Vector overshot, so the factor drops back to 1.5x.
+class AdaptiveGrowth
+{
+public:
+
+	READONLY u32 ADAPTIVE_MINIMUM = 12;     // 1.5x in eighths
+	READONLY u32 ADAPTIVE_MAXIMUM = 32;     // 4x in eighths
+	READONLY u32 ADAPTIVE_STEP    = 4;
+
+private:
+
+	u32 _Eighths;
+
+public:
+
+	AdaptiveGrowth() noexcept:
+		_Eighths(ADAPTIVE_MINIMUM)
+	{}
+
+	u32 Factor(void) const noexcept
+	{
+		return _Eighths;
+	}
+
+	/// NOTE: not const, every call is a growth event the policy learns from
+	u32 Next(const u32 length, const u32 required, const u64) noexcept
+	{
+		const u64 grown = ((u64)(length) * _Eighths) >> 3;
+		if (_Eighths < ADAPTIVE_MAXIMUM)
+			_Eighths += ADAPTIVE_STEP;
+		return _GrowthClamp(grown > length ? grown : (u64)(length) + GROWTH_MINIMUM_CAPACITY, required);
+	}
+
+	void OnShrink(void) noexcept
+	{
+		_Eighths = ADAPTIVE_MINIMUM;
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end VECTORGROWTH_HPP
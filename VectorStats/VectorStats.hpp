@@ -0,0 +1,331 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef VECTORSTATS_HPP
+#define VECTORSTATS_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Sort.hpp"
+
+#include <atomic>  // exclusively for std::atomic_flag
+#include <cstring> // exclusively for std::strcmp()
+
+namespace alt // VectorStats belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: alt::Vector reports every reallocation, element shift, & deep copy to its Instrument policy.  The default,
+/// NoVectorStats, is an empty base class whose hooks are empty inline functions, so an uninstrumented Vector is
+/// exactly as large & as fast as before.  Defining ALT_VECTOR_STATS before including Vector.hpp makes VectorStats the
+/// default instead, or a single Vector can opt in with alt::Vector<Datatype, alt::Allocator<Datatype>, VectorStats>.
+
+class NoVectorStats
+{
+public:
+
+	void OnAllocate(const u32) noexcept {}
+	void OnGrow(const u32, const u64) noexcept {}
+	void OnShrink(const u32, const u64) noexcept {}
+	void OnTruncate(const u32, const u64) noexcept {}
+	void OnShift(const u64) noexcept {}
+	void OnCopy(const u64) noexcept {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: the counters of one named call site, summed over every Vector instance reported under that name
+class VectorCounters
+{
+public:
+
+	const STR _Name;
+	u64       _Instances;
+	u64       _Grows;
+	u64       _Shrinks;
+	u64       _Truncates;
+	u64       _BytesMoved;      // Bytes copied from an old array into a new one by Grow(), Shrink(), & Truncate()
+	u64       _BytesCopied;     // Bytes copied by the copy constructor & copy assignment operator
+	u64       _Shifts;          // The number of Insert(), PushFront(), Remove(), RemoveIndices(), RemoveIf(), &
+	                            // SwapRemove() calls that shifted
+	u64       _ShiftedElements; // The number of elements those calls shifted
+	u64       _HighWater;       // The largest capacity reached, in elements
+
+	/// NOTE: every counter but _Instances starts at zero
+	explicit VectorCounters(const STR name = nullptr, const u64 instances = 0) noexcept:
+		_Name(name),
+		_Instances(instances),
+		_Grows(0),
+		_Shrinks(0),
+		_Truncates(0),
+		_BytesMoved(0),
+		_BytesCopied(0),
+		_Shifts(0),
+		_ShiftedElements(0),
+		_HighWater(0)
+	{}
+
+	/// NOTE: the cost VectorStatsRegistry::Worst() ranks call sites by, every shifted element is counted as one byte
+	u64 Cost(void) const noexcept
+	{
+		return _BytesMoved + _BytesCopied + _ShiftedElements;
+	}
+
+	/// NOTE: whether there's nothing to report, i.e. no instances & no events
+	bool Empty(void) const noexcept
+	{
+		return ! _Instances && ! _Grows && ! _Shrinks && ! _Truncates && ! _Shifts && ! Cost();
+	}
+
+	void Add(const VectorCounters& that) noexcept
+	{
+		_Instances       += that._Instances;
+		_Grows           += that._Grows;
+		_Shrinks         += that._Shrinks;
+		_Truncates       += that._Truncates;
+		_BytesMoved      += that._BytesMoved;
+		_BytesCopied     += that._BytesCopied;
+		_Shifts          += that._Shifts;
+		_ShiftedElements += that._ShiftedElements;
+		_HighWater        = that._HighWater > _HighWater ? that._HighWater : _HighWater;
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: a process wide table of the counters of every named VectorStats, keyed by name
+/// WARN: names are compared with std::strcmp() but stored by pointer, so they must outlive the registry, which string
+/// literals do
+class VectorStatsRegistry
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CONSTANTS
+public:
+
+READONLY u32 MAXIMUM_SITES = 256;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	std::atomic_flag _Lock;
+	u32              _Count;
+	VectorCounters   _Sites[MAXIMUM_SITES];
+
+	VectorStatsRegistry() noexcept:
+		_Lock(),
+		_Count(0),
+		_Sites()
+	{
+		_Lock.clear();
+	}
+
+	static VectorStatsRegistry& _Instance(void) noexcept
+	{
+		static VectorStatsRegistry registry;
+		return registry;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+/// REGISTRY METHODS
+public:
+
+/// NOTE: adds 'counters' to the site of the same name, returns true if the registry is full
+static bool Record(const VectorCounters& counters) noexcept
+{
+	VectorStatsRegistry& registry = _Instance();
+	while (registry._Lock.test_and_set(std::memory_order_acquire))
+		;
+	bool rtn = false;
+	u32 i = 0;
+	while (i < registry._Count && std::strcmp(registry._Sites[i]._Name, counters._Name))
+		i++;
+	if (i < registry._Count)
+		registry._Sites[i].Add(counters);
+	else if (i < MAXIMUM_SITES)
+	{
+		registry._Sites[i] = VectorCounters { counters._Name };
+		registry._Sites[i].Add(counters);
+		registry._Count++;
+	}
+	else
+		rtn = true;
+	registry._Lock.clear(std::memory_order_release);
+	return rtn;
+}
+
+/// NOTE: copies up to 'count' call sites into 'out' from the most to the least costly, returns how many it copied
+/// WARN: a Vector only reports its counters when it's destroyed or its VectorStats::Flush() is called, so the events of
+/// live Vectors (e.g. long lived globals) are missing until they're flushed
+static u32 Worst(VectorCounters* const out, const u32 count) noexcept
+{
+	VectorStatsRegistry& registry = _Instance();
+	while (registry._Lock.test_and_set(std::memory_order_acquire))
+		;
+	u32 order[MAXIMUM_SITES];
+	for (u32 i = 0; i < registry._Count; i++)
+		order[i] = i;
+	alt::Sort(order, registry._Count, [&registry](const u32 lhs, const u32 rhs)
+	{
+		return registry._Sites[lhs].Cost() > registry._Sites[rhs].Cost();
+	});
+	const u32 rtn = count < registry._Count ? count : registry._Count;
+	for (u32 i = 0; i < rtn; i++)
+		out[i] = registry._Sites[order[i]];
+	registry._Lock.clear(std::memory_order_release);
+	return rtn;
+}
+
+static void Reset(void) noexcept
+{
+	VectorStatsRegistry& registry = _Instance();
+	while (registry._Lock.test_and_set(std::memory_order_acquire))
+		;
+	registry._Count = 0;
+	registry._Lock.clear(std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: counts the events of one Vector, & adds them to the VectorStatsRegistry under its name when it's destroyed or
+/// flushed, unless it was never named
+class VectorStats
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MEMBER VARIABLES
+private:
+
+	VectorCounters _Counters;
+
+////////////////////////////////////////////////////////////////////////////////
+/// CONSTRUCTORS & DESTRUCTOR
+public:
+
+VectorStats() noexcept:
+	_Counters(nullptr, 1)
+{}
+
+/// NOTE: a copy is a new instance of the same call site, it doesn't inherit the history of 'copy'
+VectorStats(const VectorStats& copy) noexcept:
+	_Counters(copy._Counters._Name, 1)
+{}
+
+/// NOTE: the history moves with the array, 'move' is left with nothing to report
+VectorStats(VectorStats&& move) noexcept:
+	_Counters(move._Counters)
+{
+	move._Counters = VectorCounters { move._Counters._Name };
+}
+
+/// NOTE: a Vector keeps its own history when it's assigned to
+VectorStats& operator = (const VectorStats&) noexcept
+{
+	return *this;
+}
+
+~VectorStats() noexcept
+{
+	Flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// ACCESSORS
+public:
+
+/// NOTE: the call site this Vector's counters are reported under
+void Name(const STR const name) noexcept
+{
+	_Counters._Name = name;
+}
+
+const VectorCounters& Counters(void) const noexcept
+{
+	return _Counters;
+}
+
+/// NOTE: adds the counters to the VectorStatsRegistry now rather than when the Vector is destroyed, & starts counting
+/// again from zero, so that each event is only ever reported once
+/// RTRN: true if the registry is full
+bool Flush(void) noexcept
+{
+	if (! _Counters._Name || _Counters.Empty())
+		return false;
+	const bool rtn = VectorStatsRegistry::Record(_Counters);
+	_Counters = VectorCounters { _Counters._Name };
+	return rtn;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// HOOKS
+public:
+
+void OnAllocate(const u32 length) noexcept
+{
+	_Counters._HighWater = length > _Counters._HighWater ? length : _Counters._HighWater;
+}
+
+void OnGrow(const u32 length, const u64 bytesMoved) noexcept
+{
+	_Counters._Grows++;
+	_Counters._BytesMoved += bytesMoved;
+	OnAllocate(length);
+}
+
+void OnShrink(const u32, const u64 bytesMoved) noexcept
+{
+	_Counters._Shrinks++;
+	_Counters._BytesMoved += bytesMoved;
+}
+
+void OnTruncate(const u32, const u64 bytesMoved) noexcept
+{
+	_Counters._Truncates++;
+	_Counters._BytesMoved += bytesMoved;
+}
+
+void OnShift(const u64 elements) noexcept
+{
+	_Counters._Shifts++;
+	_Counters._ShiftedElements += elements;
+}
+
+void OnCopy(const u64 bytes) noexcept
+{
+	_Counters._BytesCopied += bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#ifdef ALT_VECTOR_STATS
+using DefaultVectorStats = VectorStats;
+#else
+using DefaultVectorStats = NoVectorStats;
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end VECTORSTATS_HPP
@@ -0,0 +1,517 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+///
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+
+#ifndef VIEW_HPP
+#define VIEW_HPP
+
+#include "Keywords.hpp"
+#include "Types.hpp"
+#include "Exceptions.hpp"
+#include "Array.hpp"
+#include "Vector.hpp"
+
+#include <type_traits> // exclusively for std::decay_t & std::invoke_result_t
+
+namespace alt // View belongs to namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: a view is a lazy, copyable cursor over a sequence.  Filter(), Map(), Take(), Skip(), Zip(), & Enumerate()
+/// only wrap the view they are called on, nothing is evaluated until ForEach(), Count(), Fold(), or CollectInto()
+/// runs, at which point the whole pipeline runs as one fused loop which the compiler inlines into a single pass over
+/// the source with no intermediate containers.
+///
+/// NOTE: every view provides
+///   - Value                     ~ the type of the elements it yields
+///   - bool Next(Value& rtn)     ~ yields the next element, returns false once exhausted
+///   - u64 Discard(u64 count)    ~ skips up to 'count' elements without evaluating them, returns how many it skipped
+///   - i64 Remaining(void) const ~ the exact number of elements left, or -1 if that isn't known without evaluating
+/// & inherits the adaptors & terminal operations below from ViewAdaptors.
+
+template <typename First, typename Second>
+class Pair
+{
+public:
+	First  _First;
+	Second _Second;
+};
+
+template <typename Datatype>
+class SpanView;
+template <typename Source, typename Predicate>
+class FilterView;
+template <typename Source, typename Function>
+class MapView;
+template <typename Source>
+class TakeView;
+template <typename Source>
+class SkipView;
+template <typename Source, typename Other>
+class ZipView;
+template <typename Source>
+class EnumerateView;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Derived, typename Datatype>
+class ViewAdaptors
+{
+////////////////////////////////////////////////////////////////////////////////
+/// ADAPTORS
+public:
+
+/// NOTE: yields only the elements for which 'predicate' returns true
+template <typename Predicate>
+FilterView<Derived, Predicate> Filter(const Predicate& predicate) const
+{
+	return FilterView<Derived, Predicate> { _Self(), predicate };
+}
+
+/// NOTE: yields 'function' applied to each element, 'function' is only called on elements that are yielded
+template <typename Function>
+MapView<Derived, Function> Map(const Function& function) const
+{
+	return MapView<Derived, Function> { _Self(), function };
+}
+
+TakeView<Derived> Take(const u64 count) const
+{
+	return TakeView<Derived> { _Self(), count };
+}
+
+SkipView<Derived> Skip(const u64 count) const
+{
+	return SkipView<Derived> { _Self(), count };
+}
+
+/// NOTE: yields alt::Pair's of the elements of both views, stopping when either is exhausted
+template <typename Other>
+ZipView<Derived, Other> Zip(const Other& other) const
+{
+	return ZipView<Derived, Other> { _Self(), other };
+}
+
+/// NOTE: yields alt::Pair's of each element's index & the element
+EnumerateView<Derived> Enumerate(void) const
+{
+	return EnumerateView<Derived> { _Self() };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// TERMINAL OPERATIONS
+public:
+
+template <typename Function>
+void ForEach(Function function) const
+{
+	Derived cursor = _Self();
+	Datatype x;
+	while (cursor.Next(x))
+		function(x);
+}
+
+/// NOTE: only evaluates the view if its Remaining() isn't known
+u64 Count(void) const
+{
+	const i64 remaining = _Self().Remaining();
+	if (remaining >= 0)
+		return (u64)(remaining);
+	Derived cursor = _Self();
+	Datatype x;
+	u64 rtn = 0;
+	while (cursor.Next(x))
+		rtn++;
+	return rtn;
+}
+
+template <typename Accumulator, typename Function>
+Accumulator Fold(Accumulator init, Function function) const
+{
+	Derived cursor = _Self();
+	Datatype x;
+	while (cursor.Next(x))
+		init = function((Accumulator&&)(init), x);
+	return init;
+}
+
+/// NOTE: appends every element to 'out', growing it once up front when Remaining() is known, returns true if 'out'
+/// could not hold them all
+template <class... Policies>
+bool CollectInto(Vector<Datatype, Policies...>& out) const
+{
+	const i64 remaining = _Self().Remaining();
+	if (remaining > 0)
+	{
+		if ((u64)(out.Size()) + (u64)(remaining) > 0xFFFFFFFFu)
+			return true;
+		out.Grow(out.Size() + (u32)(remaining));
+	}
+	Derived cursor = _Self();
+	Datatype x;
+	while (cursor.Next(x))
+		if (out.PushBack(x))
+			return true;
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// HELPER METHODS
+private:
+
+const Derived& _Self(void) const noexcept
+{
+	return *(const Derived*)(this);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: the source of every pipeline, a view over a contiguous array which the view doesn't own
+template <typename Datatype>
+class SpanView final:
+	public ViewAdaptors<SpanView<Datatype>, Datatype>
+{
+public:
+
+	using Value = Datatype;
+
+private:
+
+	const Datatype* _Next;
+	const Datatype* _End;
+
+public:
+
+SpanView(const Datatype* const base, const u64 count) noexcept:
+	_Next(base),
+	_End(base + count)
+{}
+
+bool Next(Value& rtn)
+{
+	if (_Next == _End)
+		return false;
+	rtn = *_Next++;
+	return true;
+}
+
+u64 Discard(const u64 count) noexcept
+{
+	const u64 skipped = count < (u64)(_End - _Next) ? count : (u64)(_End - _Next);
+	_Next += skipped;
+	return skipped;
+}
+
+i64 Remaining(void) const noexcept
+{
+	return _End - _Next;
+}
+};
+
+template <typename Source, typename Predicate>
+class FilterView final:
+	public ViewAdaptors<FilterView<Source, Predicate>, typename Source::Value>
+{
+public:
+
+	using Value = typename Source::Value;
+
+private:
+
+	Source    _Source;
+	Predicate _Predicate;
+
+public:
+
+FilterView(const Source& source, const Predicate& predicate):
+	_Source(source),
+	_Predicate(predicate)
+{}
+
+bool Next(Value& rtn)
+{
+	while (_Source.Next(rtn))
+		if (_Predicate((const Value&)(rtn)))
+			return true;
+	return false;
+}
+
+u64 Discard(const u64 count)
+{
+	Value x;
+	u64 skipped = 0;
+	while (skipped < count && Next(x))
+		skipped++;
+	return skipped;
+}
+
+i64 Remaining(void) const noexcept
+{
+	return -1;
+}
+};
+
+template <typename Source, typename Function>
+class MapView final:
+	public ViewAdaptors<MapView<Source, Function>,
+	                    std::decay_t<std::invoke_result_t<Function, const typename Source::Value&>>>
+{
+public:
+
+	using Value = std::decay_t<std::invoke_result_t<Function, const typename Source::Value&>>;
+
+private:
+
+	Source   _Source;
+	Function _Function;
+
+public:
+
+MapView(const Source& source, const Function& function):
+	_Source(source),
+	_Function(function)
+{}
+
+bool Next(Value& rtn)
+{
+	typename Source::Value x;
+	if (! _Source.Next(x))
+		return false;
+	rtn = _Function((const typename Source::Value&)(x));
+	return true;
+}
+
+/// NOTE: a map yields exactly one element per source element, so skipping never calls the function
+u64 Discard(const u64 count)
+{
+	return _Source.Discard(count);
+}
+
+i64 Remaining(void) const noexcept
+{
+	return _Source.Remaining();
+}
+};
+
+template <typename Source>
+class TakeView final:
+	public ViewAdaptors<TakeView<Source>, typename Source::Value>
+{
+public:
+
+	using Value = typename Source::Value;
+
+private:
+
+	Source _Source;
+	u64    _Left;
+
+public:
+
+TakeView(const Source& source, const u64 count):
+	_Source(source),
+	_Left(count)
+{}
+
+bool Next(Value& rtn)
+{
+	if (! _Left || ! _Source.Next(rtn))
+		return false;
+	_Left--;
+	return true;
+}
+
+u64 Discard(const u64 count)
+{
+	const u64 skipped = _Source.Discard(count < _Left ? count : _Left);
+	_Left -= skipped;
+	return skipped;
+}
+
+i64 Remaining(void) const noexcept
+{
+	const i64 remaining = _Source.Remaining();
+	if (remaining < 0)
+		return -1;
+	return (u64)(remaining) < _Left ? remaining : (i64)(_Left);
+}
+};
+
+template <typename Source>
+class SkipView final:
+	public ViewAdaptors<SkipView<Source>, typename Source::Value>
+{
+public:
+
+	using Value = typename Source::Value;
+
+private:
+
+	Source _Source;
+	u64    _Skip;
+
+public:
+
+SkipView(const Source& source, const u64 count):
+	_Source(source),
+	_Skip(count)
+{}
+
+bool Next(Value& rtn)
+{
+	if (_Skip)
+	{
+		_Source.Discard(_Skip);
+		_Skip = 0;
+	}
+	return _Source.Next(rtn);
+}
+
+u64 Discard(const u64 count)
+{
+	if (_Skip)
+	{
+		_Source.Discard(_Skip);
+		_Skip = 0;
+	}
+	return _Source.Discard(count);
+}
+
+i64 Remaining(void) const noexcept
+{
+	const i64 remaining = _Source.Remaining();
+	if (remaining < 0)
+		return -1;
+	return (u64)(remaining) > _Skip ? remaining - (i64)(_Skip) : 0;
+}
+};
+
+template <typename Source, typename Other>
+class ZipView final:
+	public ViewAdaptors<ZipView<Source, Other>, Pair<typename Source::Value, typename Other::Value>>
+{
+public:
+
+	using Value = Pair<typename Source::Value, typename Other::Value>;
+
+private:
+
+	Source _Source;
+	Other  _Other;
+
+public:
+
+ZipView(const Source& source, const Other& other):
+	_Source(source),
+	_Other(other)
+{}
+
+bool Next(Value& rtn)
+{
+	return _Source.Next(rtn._First) && _Other.Next(rtn._Second);
+}
+
+u64 Discard(const u64 count)
+{
+	const u64 skipped = _Source.Discard(count);
+	return _Other.Discard(skipped);
+}
+
+i64 Remaining(void) const noexcept
+{
+	const i64 lhs = _Source.Remaining();
+	const i64 rhs = _Other.Remaining();
+	if (lhs < 0 || rhs < 0)
+		return -1;
+	return lhs < rhs ? lhs : rhs;
+}
+};
+
+template <typename Source>
+class EnumerateView final:
+	public ViewAdaptors<EnumerateView<Source>, Pair<u64, typename Source::Value>>
+{
+public:
+
+	using Value = Pair<u64, typename Source::Value>;
+
+private:
+
+	Source _Source;
+	u64    _Index;
+
+public:
+
+explicit EnumerateView(const Source& source):
+	_Source(source),
+	_Index(0)
+{}
+
+bool Next(Value& rtn)
+{
+	if (! _Source.Next(rtn._Second))
+		return false;
+	rtn._First = _Index++;
+	return true;
+}
+
+u64 Discard(const u64 count)
+{
+	const u64 skipped = _Source.Discard(count);
+	_Index += skipped;
+	return skipped;
+}
+
+i64 Remaining(void) const noexcept
+{
+	return _Source.Remaining();
+}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// NOTE: the views below borrow the elements of their container, which must outlive them & stay unmodified
+
+template <typename Datatype>
+SpanView<Datatype> View(const Datatype* const base, const u64 count) noexcept
+{
+	return SpanView<Datatype> { base, count };
+}
+
+template <typename Datatype, class... Policies>
+SpanView<Datatype> View(const Vector<Datatype, Policies...>& vector) noexcept
+{
+	return SpanView<Datatype> { vector.Data(), vector.Size() };
+}
+
+template <typename Datatype, i64 _Capacity>
+SpanView<Datatype> View(const Array<Datatype, _Capacity>& array) noexcept
+{
+	return SpanView<Datatype> { &array[0], (u64)(array.Count()) };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+};
+
+#endif // end VIEW_HPP
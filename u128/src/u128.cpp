@@ -542,27 +542,27 @@ bool alt::u128::operator || (bool andarg) noexcept
 
 /// COMPARISON OPERATORS
 
-bool alt::u128::operator == (const alt::u128& that) noexcept
+bool alt::u128::operator == (const alt::u128& that) const noexcept
 {
     return (this->UpperHalf_ == that.UpperHalf_) && (this->LowerHalf_ == that.LowerHalf_);
 }
 
-bool alt::u128::operator == (const u64& that) noexcept
+bool alt::u128::operator == (const u64& that) const noexcept
 {
     return (! UpperHalf_) && (LowerHalf_ == that);
 }
 
-bool alt::u128::operator != (const alt::u128& that) noexcept
+bool alt::u128::operator != (const alt::u128& that) const noexcept
 {
     return ! this->operator==(that);
 }
 
-bool alt::u128::operator != (const u64& that) noexcept
+bool alt::u128::operator != (const u64& that) const noexcept
 {
     return ! this->operator==(that);
 }
 
-bool alt::u128::operator < (const alt::u128& that) noexcept
+bool alt::u128::operator < (const alt::u128& that) const noexcept
 {
     if (this->UpperHalf_ < that.UpperHalf_) return true;
     if (this->UpperHalf_ > that.UpperHalf_) return false;
@@ -571,7 +571,7 @@ bool alt::u128::operator < (const alt::u128& that) noexcept
     return false;
 }
 
-bool alt::u128::operator < (const u64& that) noexcept
+bool alt::u128::operator < (const u64& that) const noexcept
 {
     if (UpperHalf_)        return false;
     if (LowerHalf_ < that) return true;
@@ -579,7 +579,7 @@ bool alt::u128::operator < (const u64& that) noexcept
     return false;
 }
 
-bool alt::u128::operator > (const alt::u128& that) noexcept
+bool alt::u128::operator > (const alt::u128& that) const noexcept
 {
     if (this->UpperHalf_ > that.UpperHalf_) return true;
     if (this->UpperHalf_ < that.UpperHalf_) return false;
@@ -588,7 +588,7 @@ bool alt::u128::operator > (const alt::u128& that) noexcept
     return false;
 }
 
-bool alt::u128::operator > (const u64& that) noexcept
+bool alt::u128::operator > (const u64& that) const noexcept
 {
     if (UpperHalf_)        return true;
     if (LowerHalf_ < that) return false;
@@ -596,28 +596,28 @@ bool alt::u128::operator > (const u64& that) noexcept
     return false;
 }
 
-bool alt::u128::operator <= (const alt::u128& that) noexcept
+bool alt::u128::operator <= (const alt::u128& that) const noexcept
 {
     if (this->operator==(that))
         return true;
     return this->operator<(that);
 }
 
-bool alt::u128::operator <= (const u64& that) noexcept
+bool alt::u128::operator <= (const u64& that) const noexcept
 {
     if (this->operator==(that))
         return true;
     return this->operator<(that);
 }
 
-bool alt::u128::operator >= (const alt::u128& that) noexcept
+bool alt::u128::operator >= (const alt::u128& that) const noexcept
 {
     if (this->operator==(that))
         return true;
     return this->operator>(that);
 }
 
-bool alt::u128::operator >= (const u64& that) noexcept
+bool alt::u128::operator >= (const u64& that) const noexcept
 {
     if (this->operator==(that))
         return true;
@@ -27,6 +27,7 @@
 #include "Keywords.hpp"
 #include "Types.hpp"
 #include "Exceptions.hpp"
+#include "Sort.hpp"
 
 namespace alt
 {
@@ -160,18 +161,18 @@ public:
 public:
 
     /// COMPARISON OPERATORS
-    bool operator == (const u128& that) noexcept;
-    bool operator == (const u64&  that) noexcept;
-    bool operator != (const u128& that) noexcept;
-    bool operator != (const u64&  that) noexcept;
-    bool operator <  (const u128& that) noexcept;
-    bool operator <  (const u64&  that) noexcept;
-    bool operator >  (const u128& that) noexcept;
-    bool operator >  (const u64&  that) noexcept;
-    bool operator <= (const u128& that) noexcept;
-    bool operator <= (const u64&  that) noexcept;
-    bool operator >= (const u128& that) noexcept;
-    bool operator >= (const u64&  that) noexcept;
+    bool operator == (const u128& that) const noexcept;
+    bool operator == (const u64&  that) const noexcept;
+    bool operator != (const u128& that) const noexcept;
+    bool operator != (const u64&  that) const noexcept;
+    bool operator <  (const u128& that) const noexcept;
+    bool operator <  (const u64&  that) const noexcept;
+    bool operator >  (const u128& that) const noexcept;
+    bool operator >  (const u64&  that) const noexcept;
+    bool operator <= (const u128& that) const noexcept;
+    bool operator <= (const u64&  that) const noexcept;
+    bool operator >= (const u128& that) const noexcept;
+    bool operator >= (const u64&  that) const noexcept;
 
 ////////////////////////////////////////////////////////////
 public:
@@ -202,6 +203,26 @@ public:
 ////////////////////////////////////////////////////////////
 }; // end class u128
 
+////////////////////////////////////////////////////////////
+
+/// RADIX KEY - lets alt::Sort() & alt::StableSort() radix sort u128 keys, least significant byte first
+template <>
+class RadixKey<u128>
+{
+public:
+
+    READONLY bool Enabled = true;
+    READONLY u32  Bytes   = 16;
+
+    static u8 Digit(const u128& x, const u32 byte) noexcept
+    {
+        if (byte < 8)
+            return (u8)((u64)(x) >> (byte * 8));
+        return (u8)((u64)(x >> 64) >> ((byte - 8) * 8));
+    }
+
+}; // end class RadixKey<u128>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }; // end namespace alt
 
@@ -0,0 +1,58 @@
+/// Copyright (C) 2021 Maximilian S Puglielli (MSP)
+/// 
+/// The full copyright license belonging to this repository may be found in the
+/// parent directory in the file named 'LICENSE'.
+///
+/// This program is free software: you can redistribute it and/or modify it
+/// under the terms of the GNU General Public License as published by the Free
+/// Software Foundation, either version 3 of the License, or (at your option)
+/// any later version.
+///
+/// This program is distributed in the hope that it will be useful, but WITHOUT
+/// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+/// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+/// more details.
+///
+/// You should have received a copy of the GNU General Public License along with
+/// this program.  If not, see <https://www.gnu.org/licenses/>.
+///
+/// AUTHOR:  Maximilian S Puglielli (MSP)
+/// CREATED: 2026.10.18
+
+#ifndef U128_SERIALIZE_hpp
+#define U128_SERIALIZE_hpp
+
+/// NOTE: bridges u128 & Serialize, so that u128 itself doesn't pull in Serialize's file descriptor I/O.  Include this
+/// rather than u128.hpp wherever a u128 container is saved or loaded.
+
+#include "u128.hpp"
+#include "Serialize.hpp"
+
+namespace alt
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// SERIALIZER - u128 is two u64 halves with no invariants, so alt::Save() & alt::Load() copy it raw
+template <>
+class Serializer<u128>
+{
+public:
+
+    READONLY bool Raw = true;
+
+    static bool Save(SerialWriter& out, const u128& x) noexcept
+    {
+        return out.Write(&x, sizeof(x));
+    }
+
+    static bool Load(SerialReader& in, u128& x) noexcept
+    {
+        return in.Read(&x, sizeof(x));
+    }
+
+}; // end class Serializer<u128>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}; // end namespace alt
+
+#endif // end U128_SERIALIZE_hpp